@@ -122,6 +122,26 @@ namespace dqrng {
         return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
     }
 
+    inline Rcpp::NumericVector dqrunif_antithetic(size_t n, double min = 0.0, double max = 1.0) {
+        typedef SEXP(*Ptr_dqrunif_antithetic)(SEXP,SEXP,SEXP);
+        static Ptr_dqrunif_antithetic p_dqrunif_antithetic = NULL;
+        if (p_dqrunif_antithetic == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrunif_antithetic)(size_t,double,double)");
+            p_dqrunif_antithetic = (Ptr_dqrunif_antithetic)R_GetCCallable("dqrng", "_dqrng_dqrunif_antithetic");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrunif_antithetic(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(min)), Shield<SEXP>(Rcpp::wrap(max)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
     inline double runif(double min = 0.0, double max = 1.0) {
         typedef SEXP(*Ptr_runif)(SEXP,SEXP);
         static Ptr_runif p_runif = NULL;
@@ -162,6 +182,26 @@ namespace dqrng {
         return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
     }
 
+    inline Rcpp::NumericVector dqrnorm_antithetic(size_t n, double mean = 0.0, double sd = 1.0) {
+        typedef SEXP(*Ptr_dqrnorm_antithetic)(SEXP,SEXP,SEXP);
+        static Ptr_dqrnorm_antithetic p_dqrnorm_antithetic = NULL;
+        if (p_dqrnorm_antithetic == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrnorm_antithetic)(size_t,double,double)");
+            p_dqrnorm_antithetic = (Ptr_dqrnorm_antithetic)R_GetCCallable("dqrng", "_dqrng_dqrnorm_antithetic");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrnorm_antithetic(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mean)), Shield<SEXP>(Rcpp::wrap(sd)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
     inline double rnorm(double mean = 0.0, double sd = 1.0) {
         typedef SEXP(*Ptr_rnorm)(SEXP,SEXP);
         static Ptr_rnorm p_rnorm = NULL;
@@ -222,16 +262,16 @@ namespace dqrng {
         return Rcpp::as<double >(rcpp_result_gen);
     }
 
-    inline Rcpp::XPtr<dqrng::random_64bit_generator> get_rng() {
-        typedef SEXP(*Ptr_get_rng)();
-        static Ptr_get_rng p_get_rng = NULL;
-        if (p_get_rng == NULL) {
-            validateSignature("Rcpp::XPtr<dqrng::random_64bit_generator>(*get_rng)()");
-            p_get_rng = (Ptr_get_rng)R_GetCCallable("dqrng", "_dqrng_get_rng");
+    inline Rcpp::NumericVector dqrunif_sorted(size_t n) {
+        typedef SEXP(*Ptr_dqrunif_sorted)(SEXP);
+        static Ptr_dqrunif_sorted p_dqrunif_sorted = NULL;
+        if (p_dqrunif_sorted == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrunif_sorted)(size_t)");
+            p_dqrunif_sorted = (Ptr_dqrunif_sorted)R_GetCCallable("dqrng", "_dqrng_dqrunif_sorted");
         }
         RObject rcpp_result_gen;
         {
-            rcpp_result_gen = p_get_rng();
+            rcpp_result_gen = p_dqrunif_sorted(Shield<SEXP>(Rcpp::wrap(n)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -239,19 +279,19 @@ namespace dqrng {
             throw Rcpp::LongjumpException(rcpp_result_gen);
         if (rcpp_result_gen.inherits("try-error"))
             throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
-        return Rcpp::as<Rcpp::XPtr<dqrng::random_64bit_generator> >(rcpp_result_gen);
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
     }
 
-    inline Rcpp::IntegerVector dqrrademacher(size_t n) {
-        typedef SEXP(*Ptr_dqrrademacher)(SEXP);
-        static Ptr_dqrrademacher p_dqrrademacher = NULL;
-        if (p_dqrrademacher == NULL) {
-            validateSignature("Rcpp::IntegerVector(*dqrrademacher)(size_t)");
-            p_dqrrademacher = (Ptr_dqrrademacher)R_GetCCallable("dqrng", "_dqrng_dqrrademacher");
+    inline Rcpp::NumericMatrix dqrsobol(int n, int d, std::string scrambling = "owen", double skip = 0.0) {
+        typedef SEXP(*Ptr_dqrsobol)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_dqrsobol p_dqrsobol = NULL;
+        if (p_dqrsobol == NULL) {
+            validateSignature("Rcpp::NumericMatrix(*dqrsobol)(int,int,std::string,double)");
+            p_dqrsobol = (Ptr_dqrsobol)R_GetCCallable("dqrng", "_dqrng_dqrsobol");
         }
         RObject rcpp_result_gen;
         {
-            rcpp_result_gen = p_dqrrademacher(Shield<SEXP>(Rcpp::wrap(n)));
+            rcpp_result_gen = p_dqrsobol(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(d)), Shield<SEXP>(Rcpp::wrap(scrambling)), Shield<SEXP>(Rcpp::wrap(skip)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -259,19 +299,119 @@ namespace dqrng {
             throw Rcpp::LongjumpException(rcpp_result_gen);
         if (rcpp_result_gen.inherits("try-error"))
             throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
-        return Rcpp::as<Rcpp::IntegerVector >(rcpp_result_gen);
+        return Rcpp::as<Rcpp::NumericMatrix >(rcpp_result_gen);
     }
 
-    inline Rcpp::IntegerVector dqsample_int(int n, int size, bool replace = false, Rcpp::Nullable<Rcpp::NumericVector> probs = R_NilValue, int offset = 0) {
-        typedef SEXP(*Ptr_dqsample_int)(SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_dqsample_int p_dqsample_int = NULL;
-        if (p_dqsample_int == NULL) {
-            validateSignature("Rcpp::IntegerVector(*dqsample_int)(int,int,bool,Rcpp::Nullable<Rcpp::NumericVector>,int)");
-            p_dqsample_int = (Ptr_dqsample_int)R_GetCCallable("dqrng", "_dqrng_dqsample_int");
+    inline Rcpp::NumericMatrix dqrhalton(int n, int d, bool permute = true, double skip = 0.0) {
+        typedef SEXP(*Ptr_dqrhalton)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_dqrhalton p_dqrhalton = NULL;
+        if (p_dqrhalton == NULL) {
+            validateSignature("Rcpp::NumericMatrix(*dqrhalton)(int,int,bool,double)");
+            p_dqrhalton = (Ptr_dqrhalton)R_GetCCallable("dqrng", "_dqrng_dqrhalton");
         }
         RObject rcpp_result_gen;
         {
-            rcpp_result_gen = p_dqsample_int(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(replace)), Shield<SEXP>(Rcpp::wrap(probs)), Shield<SEXP>(Rcpp::wrap(offset)));
+            rcpp_result_gen = p_dqrhalton(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(d)), Shield<SEXP>(Rcpp::wrap(permute)), Shield<SEXP>(Rcpp::wrap(skip)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericMatrix >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericMatrix dqrlhs(int n, int d) {
+        typedef SEXP(*Ptr_dqrlhs)(SEXP,SEXP);
+        static Ptr_dqrlhs p_dqrlhs = NULL;
+        if (p_dqrlhs == NULL) {
+            validateSignature("Rcpp::NumericMatrix(*dqrlhs)(int,int)");
+            p_dqrlhs = (Ptr_dqrlhs)R_GetCCallable("dqrng", "_dqrng_dqrlhs");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrlhs(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(d)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericMatrix >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrunif_stratified(Rcpp::IntegerVector n, Rcpp::NumericVector breaks) {
+        typedef SEXP(*Ptr_dqrunif_stratified)(SEXP,SEXP);
+        static Ptr_dqrunif_stratified p_dqrunif_stratified = NULL;
+        if (p_dqrunif_stratified == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrunif_stratified)(Rcpp::IntegerVector,Rcpp::NumericVector)");
+            p_dqrunif_stratified = (Ptr_dqrunif_stratified)R_GetCCallable("dqrng", "_dqrng_dqrunif_stratified");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrunif_stratified(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(breaks)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericMatrix dqrbrownian(int n_paths, int n_steps, double dt = 1.0, double drift = 0.0, double sigma = 1.0, double x0 = 0.0, bool bridge = false) {
+        typedef SEXP(*Ptr_dqrbrownian)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_dqrbrownian p_dqrbrownian = NULL;
+        if (p_dqrbrownian == NULL) {
+            validateSignature("Rcpp::NumericMatrix(*dqrbrownian)(int,int,double,double,double,double,bool)");
+            p_dqrbrownian = (Ptr_dqrbrownian)R_GetCCallable("dqrng", "_dqrng_dqrbrownian");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrbrownian(Shield<SEXP>(Rcpp::wrap(n_paths)), Shield<SEXP>(Rcpp::wrap(n_steps)), Shield<SEXP>(Rcpp::wrap(dt)), Shield<SEXP>(Rcpp::wrap(drift)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(x0)), Shield<SEXP>(Rcpp::wrap(bridge)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericMatrix >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericMatrix dqrgbm(int n_paths, int n_steps, double dt = 1.0, double drift = 0.0, double sigma = 1.0, double s0 = 1.0, bool bridge = false) {
+        typedef SEXP(*Ptr_dqrgbm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_dqrgbm p_dqrgbm = NULL;
+        if (p_dqrgbm == NULL) {
+            validateSignature("Rcpp::NumericMatrix(*dqrgbm)(int,int,double,double,double,double,bool)");
+            p_dqrgbm = (Ptr_dqrgbm)R_GetCCallable("dqrng", "_dqrng_dqrgbm");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrgbm(Shield<SEXP>(Rcpp::wrap(n_paths)), Shield<SEXP>(Rcpp::wrap(n_steps)), Shield<SEXP>(Rcpp::wrap(dt)), Shield<SEXP>(Rcpp::wrap(drift)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(s0)), Shield<SEXP>(Rcpp::wrap(bridge)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericMatrix >(rcpp_result_gen);
+    }
+
+    inline Rcpp::IntegerVector dqrbinom(size_t n, Rcpp::NumericVector size, Rcpp::NumericVector prob) {
+        typedef SEXP(*Ptr_dqrbinom)(SEXP,SEXP,SEXP);
+        static Ptr_dqrbinom p_dqrbinom = NULL;
+        if (p_dqrbinom == NULL) {
+            validateSignature("Rcpp::IntegerVector(*dqrbinom)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+            p_dqrbinom = (Ptr_dqrbinom)R_GetCCallable("dqrng", "_dqrng_dqrbinom");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrbinom(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(prob)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -282,16 +422,756 @@ namespace dqrng {
         return Rcpp::as<Rcpp::IntegerVector >(rcpp_result_gen);
     }
 
-    inline Rcpp::NumericVector dqsample_num(double n, double size, bool replace = false, Rcpp::Nullable<Rcpp::NumericVector> probs = R_NilValue, int offset = 0) {
-        typedef SEXP(*Ptr_dqsample_num)(SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_dqsample_num p_dqsample_num = NULL;
-        if (p_dqsample_num == NULL) {
-            validateSignature("Rcpp::NumericVector(*dqsample_num)(double,double,bool,Rcpp::Nullable<Rcpp::NumericVector>,int)");
-            p_dqsample_num = (Ptr_dqsample_num)R_GetCCallable("dqrng", "_dqrng_dqsample_num");
+    inline Rcpp::NumericVector dqrgeom(size_t n, Rcpp::NumericVector prob) {
+        typedef SEXP(*Ptr_dqrgeom)(SEXP,SEXP);
+        static Ptr_dqrgeom p_dqrgeom = NULL;
+        if (p_dqrgeom == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrgeom)(size_t,Rcpp::NumericVector)");
+            p_dqrgeom = (Ptr_dqrgeom)R_GetCCallable("dqrng", "_dqrng_dqrgeom");
         }
         RObject rcpp_result_gen;
         {
-            rcpp_result_gen = p_dqsample_num(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(replace)), Shield<SEXP>(Rcpp::wrap(probs)), Shield<SEXP>(Rcpp::wrap(offset)));
+            rcpp_result_gen = p_dqrgeom(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrnbinom(size_t n, Rcpp::NumericVector size, Rcpp::Nullable<Rcpp::NumericVector> prob = R_NilValue, Rcpp::Nullable<Rcpp::NumericVector> mu = R_NilValue) {
+        typedef SEXP(*Ptr_dqrnbinom)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_dqrnbinom p_dqrnbinom = NULL;
+        if (p_dqrnbinom == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrnbinom)(size_t,Rcpp::NumericVector,Rcpp::Nullable<Rcpp::NumericVector>,Rcpp::Nullable<Rcpp::NumericVector>)");
+            p_dqrnbinom = (Ptr_dqrnbinom)R_GetCCallable("dqrng", "_dqrng_dqrnbinom");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrnbinom(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(prob)), Shield<SEXP>(Rcpp::wrap(mu)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrzipf(size_t n, Rcpp::NumericVector N, Rcpp::NumericVector s) {
+        typedef SEXP(*Ptr_dqrzipf)(SEXP,SEXP,SEXP);
+        static Ptr_dqrzipf p_dqrzipf = NULL;
+        if (p_dqrzipf == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrzipf)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+            p_dqrzipf = (Ptr_dqrzipf)R_GetCCallable("dqrng", "_dqrng_dqrzipf");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrzipf(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(N)), Shield<SEXP>(Rcpp::wrap(s)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrmixture_family(size_t n, Rcpp::NumericVector weights, std::string family, Rcpp::NumericVector param1, Rcpp::NumericVector param2) {
+        typedef SEXP(*Ptr_dqrmixture_family)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_dqrmixture_family p_dqrmixture_family = NULL;
+        if (p_dqrmixture_family == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrmixture_family)(size_t,Rcpp::NumericVector,std::string,Rcpp::NumericVector,Rcpp::NumericVector)");
+            p_dqrmixture_family = (Ptr_dqrmixture_family)R_GetCCallable("dqrng", "_dqrng_dqrmixture_family");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrmixture_family(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(weights)), Shield<SEXP>(Rcpp::wrap(family)), Shield<SEXP>(Rcpp::wrap(param1)), Shield<SEXP>(Rcpp::wrap(param2)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List dqrsparse_pattern(int nrow, int ncol, double density) {
+        typedef SEXP(*Ptr_dqrsparse_pattern)(SEXP,SEXP,SEXP);
+        static Ptr_dqrsparse_pattern p_dqrsparse_pattern = NULL;
+        if (p_dqrsparse_pattern == NULL) {
+            validateSignature("Rcpp::List(*dqrsparse_pattern)(int,int,double)");
+            p_dqrsparse_pattern = (Ptr_dqrsparse_pattern)R_GetCCallable("dqrng", "_dqrng_dqrsparse_pattern");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrsparse_pattern(Shield<SEXP>(Rcpp::wrap(nrow)), Shield<SEXP>(Rcpp::wrap(ncol)), Shield<SEXP>(Rcpp::wrap(density)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
+    inline Rcpp::IntegerMatrix dqrgraph_gnp(int n, double p) {
+        typedef SEXP(*Ptr_dqrgraph_gnp)(SEXP,SEXP);
+        static Ptr_dqrgraph_gnp p_dqrgraph_gnp = NULL;
+        if (p_dqrgraph_gnp == NULL) {
+            validateSignature("Rcpp::IntegerMatrix(*dqrgraph_gnp)(int,double)");
+            p_dqrgraph_gnp = (Ptr_dqrgraph_gnp)R_GetCCallable("dqrng", "_dqrng_dqrgraph_gnp");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrgraph_gnp(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(p)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::IntegerMatrix >(rcpp_result_gen);
+    }
+
+    inline Rcpp::IntegerMatrix dqrgraph_gnm(int n, double m) {
+        typedef SEXP(*Ptr_dqrgraph_gnm)(SEXP,SEXP);
+        static Ptr_dqrgraph_gnm p_dqrgraph_gnm = NULL;
+        if (p_dqrgraph_gnm == NULL) {
+            validateSignature("Rcpp::IntegerMatrix(*dqrgraph_gnm)(int,double)");
+            p_dqrgraph_gnm = (Ptr_dqrgraph_gnm)R_GetCCallable("dqrng", "_dqrng_dqrgraph_gnm");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrgraph_gnm(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(m)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::IntegerMatrix >(rcpp_result_gen);
+    }
+
+    inline Rcpp::IntegerMatrix dqrgraph_sbm(Rcpp::IntegerVector block_sizes, Rcpp::NumericMatrix prob) {
+        typedef SEXP(*Ptr_dqrgraph_sbm)(SEXP,SEXP);
+        static Ptr_dqrgraph_sbm p_dqrgraph_sbm = NULL;
+        if (p_dqrgraph_sbm == NULL) {
+            validateSignature("Rcpp::IntegerMatrix(*dqrgraph_sbm)(Rcpp::IntegerVector,Rcpp::NumericMatrix)");
+            p_dqrgraph_sbm = (Ptr_dqrgraph_sbm)R_GetCCallable("dqrng", "_dqrng_dqrgraph_sbm");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrgraph_sbm(Shield<SEXP>(Rcpp::wrap(block_sizes)), Shield<SEXP>(Rcpp::wrap(prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::IntegerMatrix >(rcpp_result_gen);
+    }
+
+    inline Rcpp::IntegerMatrix dqrmultinom(int n, int size, Rcpp::NumericVector prob) {
+        typedef SEXP(*Ptr_dqrmultinom)(SEXP,SEXP,SEXP);
+        static Ptr_dqrmultinom p_dqrmultinom = NULL;
+        if (p_dqrmultinom == NULL) {
+            validateSignature("Rcpp::IntegerMatrix(*dqrmultinom)(int,int,Rcpp::NumericVector)");
+            p_dqrmultinom = (Ptr_dqrmultinom)R_GetCCallable("dqrng", "_dqrng_dqrmultinom");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrmultinom(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::IntegerMatrix >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrtnorm(size_t n, Rcpp::NumericVector mean, Rcpp::NumericVector sd, Rcpp::NumericVector lower, Rcpp::NumericVector upper) {
+        typedef SEXP(*Ptr_dqrtnorm)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_dqrtnorm p_dqrtnorm = NULL;
+        if (p_dqrtnorm == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrtnorm)(size_t,Rcpp::NumericVector,Rcpp::NumericVector,Rcpp::NumericVector,Rcpp::NumericVector)");
+            p_dqrtnorm = (Ptr_dqrtnorm)R_GetCCallable("dqrng", "_dqrng_dqrtnorm");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrtnorm(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mean)), Shield<SEXP>(Rcpp::wrap(sd)), Shield<SEXP>(Rcpp::wrap(lower)), Shield<SEXP>(Rcpp::wrap(upper)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrlnorm(size_t n, Rcpp::NumericVector meanlog = Rcpp::NumericVector::create(0.0), Rcpp::NumericVector sdlog = Rcpp::NumericVector::create(1.0)) {
+        typedef SEXP(*Ptr_dqrlnorm)(SEXP,SEXP,SEXP);
+        static Ptr_dqrlnorm p_dqrlnorm = NULL;
+        if (p_dqrlnorm == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrlnorm)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+            p_dqrlnorm = (Ptr_dqrlnorm)R_GetCCallable("dqrng", "_dqrng_dqrlnorm");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrlnorm(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(meanlog)), Shield<SEXP>(Rcpp::wrap(sdlog)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrweibull(size_t n, Rcpp::NumericVector shape, Rcpp::NumericVector scale = Rcpp::NumericVector::create(1.0)) {
+        typedef SEXP(*Ptr_dqrweibull)(SEXP,SEXP,SEXP);
+        static Ptr_dqrweibull p_dqrweibull = NULL;
+        if (p_dqrweibull == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrweibull)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+            p_dqrweibull = (Ptr_dqrweibull)R_GetCCallable("dqrng", "_dqrng_dqrweibull");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrweibull(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(shape)), Shield<SEXP>(Rcpp::wrap(scale)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrcauchy(size_t n, Rcpp::NumericVector location = Rcpp::NumericVector::create(0.0), Rcpp::NumericVector scale = Rcpp::NumericVector::create(1.0)) {
+        typedef SEXP(*Ptr_dqrcauchy)(SEXP,SEXP,SEXP);
+        static Ptr_dqrcauchy p_dqrcauchy = NULL;
+        if (p_dqrcauchy == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrcauchy)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+            p_dqrcauchy = (Ptr_dqrcauchy)R_GetCCallable("dqrng", "_dqrng_dqrcauchy");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrcauchy(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(location)), Shield<SEXP>(Rcpp::wrap(scale)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrlogis(size_t n, Rcpp::NumericVector location = Rcpp::NumericVector::create(0.0), Rcpp::NumericVector scale = Rcpp::NumericVector::create(1.0)) {
+        typedef SEXP(*Ptr_dqrlogis)(SEXP,SEXP,SEXP);
+        static Ptr_dqrlogis p_dqrlogis = NULL;
+        if (p_dqrlogis == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrlogis)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+            p_dqrlogis = (Ptr_dqrlogis)R_GetCCallable("dqrng", "_dqrng_dqrlogis");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrlogis(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(location)), Shield<SEXP>(Rcpp::wrap(scale)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrgumbel(size_t n, Rcpp::NumericVector location = Rcpp::NumericVector::create(0.0), Rcpp::NumericVector scale = Rcpp::NumericVector::create(1.0)) {
+        typedef SEXP(*Ptr_dqrgumbel)(SEXP,SEXP,SEXP);
+        static Ptr_dqrgumbel p_dqrgumbel = NULL;
+        if (p_dqrgumbel == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrgumbel)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+            p_dqrgumbel = (Ptr_dqrgumbel)R_GetCCallable("dqrng", "_dqrng_dqrgumbel");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrgumbel(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(location)), Shield<SEXP>(Rcpp::wrap(scale)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrlaplace(size_t n, Rcpp::NumericVector location = Rcpp::NumericVector::create(0.0), Rcpp::NumericVector scale = Rcpp::NumericVector::create(1.0)) {
+        typedef SEXP(*Ptr_dqrlaplace)(SEXP,SEXP,SEXP);
+        static Ptr_dqrlaplace p_dqrlaplace = NULL;
+        if (p_dqrlaplace == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrlaplace)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+            p_dqrlaplace = (Ptr_dqrlaplace)R_GetCCallable("dqrng", "_dqrng_dqrlaplace");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrlaplace(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(location)), Shield<SEXP>(Rcpp::wrap(scale)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrvonmises(size_t n, Rcpp::NumericVector mu, Rcpp::NumericVector kappa) {
+        typedef SEXP(*Ptr_dqrvonmises)(SEXP,SEXP,SEXP);
+        static Ptr_dqrvonmises p_dqrvonmises = NULL;
+        if (p_dqrvonmises == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrvonmises)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+            p_dqrvonmises = (Ptr_dqrvonmises)R_GetCCallable("dqrng", "_dqrng_dqrvonmises");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrvonmises(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(kappa)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrwrappednorm(size_t n, Rcpp::NumericVector mu, Rcpp::NumericVector sd) {
+        typedef SEXP(*Ptr_dqrwrappednorm)(SEXP,SEXP,SEXP);
+        static Ptr_dqrwrappednorm p_dqrwrappednorm = NULL;
+        if (p_dqrwrappednorm == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrwrappednorm)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+            p_dqrwrappednorm = (Ptr_dqrwrappednorm)R_GetCCallable("dqrng", "_dqrng_dqrwrappednorm");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrwrappednorm(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sd)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrwrappedcauchy(size_t n, Rcpp::NumericVector mu, Rcpp::NumericVector rho) {
+        typedef SEXP(*Ptr_dqrwrappedcauchy)(SEXP,SEXP,SEXP);
+        static Ptr_dqrwrappedcauchy p_dqrwrappedcauchy = NULL;
+        if (p_dqrwrappedcauchy == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrwrappedcauchy)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+            p_dqrwrappedcauchy = (Ptr_dqrwrappedcauchy)R_GetCCallable("dqrng", "_dqrng_dqrwrappedcauchy");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrwrappedcauchy(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(rho)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::IntegerVector dqrhyper(size_t nn, Rcpp::NumericVector m, Rcpp::NumericVector n, Rcpp::NumericVector k) {
+        typedef SEXP(*Ptr_dqrhyper)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_dqrhyper p_dqrhyper = NULL;
+        if (p_dqrhyper == NULL) {
+            validateSignature("Rcpp::IntegerVector(*dqrhyper)(size_t,Rcpp::NumericVector,Rcpp::NumericVector,Rcpp::NumericVector)");
+            p_dqrhyper = (Ptr_dqrhyper)R_GetCCallable("dqrng", "_dqrng_dqrhyper");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrhyper(Shield<SEXP>(Rcpp::wrap(nn)), Shield<SEXP>(Rcpp::wrap(m)), Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(k)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::IntegerVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::IntegerMatrix dqrmvhyper(int n, Rcpp::NumericVector m, int k) {
+        typedef SEXP(*Ptr_dqrmvhyper)(SEXP,SEXP,SEXP);
+        static Ptr_dqrmvhyper p_dqrmvhyper = NULL;
+        if (p_dqrmvhyper == NULL) {
+            validateSignature("Rcpp::IntegerMatrix(*dqrmvhyper)(int,Rcpp::NumericVector,int)");
+            p_dqrmvhyper = (Ptr_dqrmvhyper)R_GetCCallable("dqrng", "_dqrng_dqrmvhyper");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrmvhyper(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(m)), Shield<SEXP>(Rcpp::wrap(k)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::IntegerMatrix >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericMatrix dqrdirichlet(int n, Rcpp::NumericVector alpha) {
+        typedef SEXP(*Ptr_dqrdirichlet)(SEXP,SEXP);
+        static Ptr_dqrdirichlet p_dqrdirichlet = NULL;
+        if (p_dqrdirichlet == NULL) {
+            validateSignature("Rcpp::NumericMatrix(*dqrdirichlet)(int,Rcpp::NumericVector)");
+            p_dqrdirichlet = (Ptr_dqrdirichlet)R_GetCCallable("dqrng", "_dqrng_dqrdirichlet");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrdirichlet(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(alpha)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericMatrix >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrwishart(int n, double df, Rcpp::NumericMatrix Sigma) {
+        typedef SEXP(*Ptr_dqrwishart)(SEXP,SEXP,SEXP);
+        static Ptr_dqrwishart p_dqrwishart = NULL;
+        if (p_dqrwishart == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrwishart)(int,double,Rcpp::NumericMatrix)");
+            p_dqrwishart = (Ptr_dqrwishart)R_GetCCallable("dqrng", "_dqrng_dqrwishart");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrwishart(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(df)), Shield<SEXP>(Rcpp::wrap(Sigma)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrinvwishart(int n, double df, Rcpp::NumericMatrix Sigma) {
+        typedef SEXP(*Ptr_dqrinvwishart)(SEXP,SEXP,SEXP);
+        static Ptr_dqrinvwishart p_dqrinvwishart = NULL;
+        if (p_dqrinvwishart == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrinvwishart)(int,double,Rcpp::NumericMatrix)");
+            p_dqrinvwishart = (Ptr_dqrinvwishart)R_GetCCallable("dqrng", "_dqrng_dqrinvwishart");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrinvwishart(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(df)), Shield<SEXP>(Rcpp::wrap(Sigma)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericMatrix dqrsphere(int n, int d) {
+        typedef SEXP(*Ptr_dqrsphere)(SEXP,SEXP);
+        static Ptr_dqrsphere p_dqrsphere = NULL;
+        if (p_dqrsphere == NULL) {
+            validateSignature("Rcpp::NumericMatrix(*dqrsphere)(int,int)");
+            p_dqrsphere = (Ptr_dqrsphere)R_GetCCallable("dqrng", "_dqrng_dqrsphere");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrsphere(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(d)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericMatrix >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericMatrix dqrball(int n, int d) {
+        typedef SEXP(*Ptr_dqrball)(SEXP,SEXP);
+        static Ptr_dqrball p_dqrball = NULL;
+        if (p_dqrball == NULL) {
+            validateSignature("Rcpp::NumericMatrix(*dqrball)(int,int)");
+            p_dqrball = (Ptr_dqrball)R_GetCCallable("dqrng", "_dqrng_dqrball");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrball(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(d)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericMatrix >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericMatrix dqrsimplex(int n, int d) {
+        typedef SEXP(*Ptr_dqrsimplex)(SEXP,SEXP);
+        static Ptr_dqrsimplex p_dqrsimplex = NULL;
+        if (p_dqrsimplex == NULL) {
+            validateSignature("Rcpp::NumericMatrix(*dqrsimplex)(int,int)");
+            p_dqrsimplex = (Ptr_dqrsimplex)R_GetCCallable("dqrng", "_dqrng_dqrsimplex");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrsimplex(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(d)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericMatrix >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrorthogonal(int n, int d) {
+        typedef SEXP(*Ptr_dqrorthogonal)(SEXP,SEXP);
+        static Ptr_dqrorthogonal p_dqrorthogonal = NULL;
+        if (p_dqrorthogonal == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrorthogonal)(int,int)");
+            p_dqrorthogonal = (Ptr_dqrorthogonal)R_GetCCallable("dqrng", "_dqrng_dqrorthogonal");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrorthogonal(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(d)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqrrotation(int n, int d) {
+        typedef SEXP(*Ptr_dqrrotation)(SEXP,SEXP);
+        static Ptr_dqrrotation p_dqrrotation = NULL;
+        if (p_dqrrotation == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqrrotation)(int,int)");
+            p_dqrrotation = (Ptr_dqrrotation)R_GetCCallable("dqrng", "_dqrng_dqrrotation");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrrotation(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(d)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericMatrix dqrmvnorm_chol(int n, Rcpp::NumericVector mean, Rcpp::NumericMatrix root, Rcpp::IntegerVector pivot, int threads = 1) {
+        typedef SEXP(*Ptr_dqrmvnorm_chol)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_dqrmvnorm_chol p_dqrmvnorm_chol = NULL;
+        if (p_dqrmvnorm_chol == NULL) {
+            validateSignature("Rcpp::NumericMatrix(*dqrmvnorm_chol)(int,Rcpp::NumericVector,Rcpp::NumericMatrix,Rcpp::IntegerVector,int)");
+            p_dqrmvnorm_chol = (Ptr_dqrmvnorm_chol)R_GetCCallable("dqrng", "_dqrng_dqrmvnorm_chol");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrmvnorm_chol(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mean)), Shield<SEXP>(Rcpp::wrap(root)), Shield<SEXP>(Rcpp::wrap(pivot)), Shield<SEXP>(Rcpp::wrap(threads)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericMatrix >(rcpp_result_gen);
+    }
+
+    inline Rcpp::XPtr<dqrng::random_64bit_generator> get_rng() {
+        typedef SEXP(*Ptr_get_rng)();
+        static Ptr_get_rng p_get_rng = NULL;
+        if (p_get_rng == NULL) {
+            validateSignature("Rcpp::XPtr<dqrng::random_64bit_generator>(*get_rng)()");
+            p_get_rng = (Ptr_get_rng)R_GetCCallable("dqrng", "_dqrng_get_rng");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_get_rng();
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::XPtr<dqrng::random_64bit_generator> >(rcpp_result_gen);
+    }
+
+    inline Rcpp::IntegerVector dqrrademacher(size_t n) {
+        typedef SEXP(*Ptr_dqrrademacher)(SEXP);
+        static Ptr_dqrrademacher p_dqrrademacher = NULL;
+        if (p_dqrrademacher == NULL) {
+            validateSignature("Rcpp::IntegerVector(*dqrrademacher)(size_t)");
+            p_dqrrademacher = (Ptr_dqrrademacher)R_GetCCallable("dqrng", "_dqrng_dqrrademacher");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrrademacher(Shield<SEXP>(Rcpp::wrap(n)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::IntegerVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::IntegerVector dqsample_int(int n, int size, bool replace = false, Rcpp::Nullable<Rcpp::NumericVector> probs = R_NilValue, int offset = 0) {
+        typedef SEXP(*Ptr_dqsample_int)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_dqsample_int p_dqsample_int = NULL;
+        if (p_dqsample_int == NULL) {
+            validateSignature("Rcpp::IntegerVector(*dqsample_int)(int,int,bool,Rcpp::Nullable<Rcpp::NumericVector>,int)");
+            p_dqsample_int = (Ptr_dqsample_int)R_GetCCallable("dqrng", "_dqrng_dqsample_int");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqsample_int(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(replace)), Shield<SEXP>(Rcpp::wrap(probs)), Shield<SEXP>(Rcpp::wrap(offset)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::IntegerVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqsample_num(double n, double size, bool replace = false, Rcpp::Nullable<Rcpp::NumericVector> probs = R_NilValue, int offset = 0) {
+        typedef SEXP(*Ptr_dqsample_num)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_dqsample_num p_dqsample_num = NULL;
+        if (p_dqsample_num == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqsample_num)(double,double,bool,Rcpp::Nullable<Rcpp::NumericVector>,int)");
+            p_dqsample_num = (Ptr_dqsample_num)R_GetCCallable("dqrng", "_dqrng_dqsample_num");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqsample_num(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(replace)), Shield<SEXP>(Rcpp::wrap(probs)), Shield<SEXP>(Rcpp::wrap(offset)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::IntegerMatrix dqrperm_matrix(int n, int B, int threads = 1) {
+        typedef SEXP(*Ptr_dqrperm_matrix)(SEXP,SEXP,SEXP);
+        static Ptr_dqrperm_matrix p_dqrperm_matrix = NULL;
+        if (p_dqrperm_matrix == NULL) {
+            validateSignature("Rcpp::IntegerMatrix(*dqrperm_matrix)(int,int,int)");
+            p_dqrperm_matrix = (Ptr_dqrperm_matrix)R_GetCCallable("dqrng", "_dqrng_dqrperm_matrix");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqrperm_matrix(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(B)), Shield<SEXP>(Rcpp::wrap(threads)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::IntegerMatrix >(rcpp_result_gen);
+    }
+
+    inline SEXP dqalias_table(Rcpp::NumericVector prob) {
+        typedef SEXP(*Ptr_dqalias_table)(SEXP);
+        static Ptr_dqalias_table p_dqalias_table = NULL;
+        if (p_dqalias_table == NULL) {
+            validateSignature("SEXP(*dqalias_table)(Rcpp::NumericVector)");
+            p_dqalias_table = (Ptr_dqalias_table)R_GetCCallable("dqrng", "_dqrng_dqalias_table");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqalias_table(Shield<SEXP>(Rcpp::wrap(prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<SEXP >(rcpp_result_gen);
+    }
+
+    inline Rcpp::IntegerVector dqsample_alias_int(SEXP table, int n, int size, int offset = 0) {
+        typedef SEXP(*Ptr_dqsample_alias_int)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_dqsample_alias_int p_dqsample_alias_int = NULL;
+        if (p_dqsample_alias_int == NULL) {
+            validateSignature("Rcpp::IntegerVector(*dqsample_alias_int)(SEXP,int,int,int)");
+            p_dqsample_alias_int = (Ptr_dqsample_alias_int)R_GetCCallable("dqrng", "_dqrng_dqsample_alias_int");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqsample_alias_int(Shield<SEXP>(Rcpp::wrap(table)), Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(offset)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::IntegerVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::NumericVector dqsample_alias_num(SEXP table, double n, double size, int offset = 0) {
+        typedef SEXP(*Ptr_dqsample_alias_num)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_dqsample_alias_num p_dqsample_alias_num = NULL;
+        if (p_dqsample_alias_num == NULL) {
+            validateSignature("Rcpp::NumericVector(*dqsample_alias_num)(SEXP,double,double,int)");
+            p_dqsample_alias_num = (Ptr_dqsample_alias_num)R_GetCCallable("dqrng", "_dqrng_dqsample_alias_num");
+        }
+        RObject rcpp_result_gen;
+        {
+            rcpp_result_gen = p_dqsample_alias_num(Shield<SEXP>(Rcpp::wrap(table)), Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(offset)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -20,10 +20,17 @@
 #define DQRNG_DISTRIBUTION_H 1
 
 #include <mystdint.h>
+#include <algorithm>
+#include <cmath>
+#include <iterator>
 #include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 #include <boost/random/uniform_real_distribution.hpp>
 #include <boost/random/normal_distribution.hpp>
 #include <boost/random/exponential_distribution.hpp>
+#include <boost/random/poisson_distribution.hpp>
 #include <dqrng_generator.h>
 
 namespace dqrng {
@@ -71,4 +78,2145 @@ inline double generate_uniform_real<dqrng::random_64bit_accessor, double>(dqrng:
 } // namespace random
 } // namespace boost
 
+namespace dqrng {
+// Uniform, normal and exponential distributions with the standard parameters
+// fixed at compile time. They use the same kernels as the general
+// distributions above and produce identical values, but skip loading and
+// applying location and scale for every variate. The boost kernels call
+// generate_int_float_pair, so these classes have to follow the specializations
+// for random_64bit_generator above.
+class standard_uniform_distribution {
+public:
+  using result_type = double;
+
+  void reset() {}
+  result_type min() const {return 0.0;}
+  result_type max() const {return 1.0;}
+
+  result_type operator()(random_64bit_generator& rng) const {
+    return rng.uniform01();
+  }
+};
+
+class standard_normal_distribution {
+public:
+  using result_type = double;
+
+  void reset() {}
+  result_type min() const {return -INFINITY;}
+  result_type max() const {return INFINITY;}
+
+  result_type operator()(random_64bit_generator& rng) const {
+    return boost::random::detail::unit_normal_distribution<double>()(rng);
+  }
+};
+
+class standard_exponential_distribution {
+public:
+  using result_type = double;
+
+  void reset() {}
+  result_type min() const {return 0.0;}
+  result_type max() const {return INFINITY;}
+
+  result_type operator()(random_64bit_generator& rng) const {
+    return boost::random::detail::unit_exponential_distribution<double>()(rng);
+  }
+};
+
+// Binomial distribution using inversion for t * min(p, 1 - p) < 30 and the
+// BTPE algorithm from Kachitvichyanukul and Schmeiser (1988,
+// doi:10.1145/42372.42381) otherwise. The setup for the chosen algorithm is
+// cached and only recomputed when the parameters change, which makes it cheap
+// to draw many variates with recycled parameter vectors.
+class binomial_distribution {
+public:
+  using result_type = int;
+
+  class param_type {
+  private:
+    int _t;
+    double _p;
+
+  public:
+    using distribution_type = binomial_distribution;
+
+    explicit param_type(int t = 1, double p = 0.5) : _t(t), _p(p) {
+      if (!(t >= 0))
+        throw std::invalid_argument("Binomial distribution requires t >= 0");
+      if (!(p >= 0.0 && p <= 1.0))
+        throw std::invalid_argument("Binomial distribution requires 0 <= p <= 1");
+    }
+
+    int t() const {return _t;}
+    double p() const {return _p;}
+
+    friend bool operator==(const param_type& lhs, const param_type& rhs) {
+      return lhs._t == rhs._t && lhs._p == rhs._p;
+    }
+    friend bool operator!=(const param_type& lhs, const param_type& rhs) {
+      return !(lhs == rhs);
+    }
+  };
+
+private:
+  param_type _param;
+  // setup shared by both algorithms
+  double r, q, np;
+  bool use_btpe;
+  // inversion
+  double qn;
+  int bound;
+  // BTPE
+  int m;
+  double fm, p1, xm, xl, xr, c, laml, lamr, p2, p3, p4, nrq;
+
+  void init() {
+    int n = _param.t();
+    r = std::min(_param.p(), 1.0 - _param.p());
+    q = 1.0 - r;
+    np = n * r;
+    use_btpe = np >= 30.0;
+    if (!use_btpe) {
+      qn = std::exp(n * std::log(q));
+      bound = int(std::min(double(n), np + 10.0 * std::sqrt(np * q + 1.0)));
+    } else {
+      fm = np + r;
+      m = int(fm);
+      p1 = std::floor(2.195 * std::sqrt(np * q) - 4.6 * q) + 0.5;
+      xm = m + 0.5;
+      xl = xm - p1;
+      xr = xm + p1;
+      c = 0.134 + 20.5 / (15.3 + m);
+      double a = (fm - xl) / (fm - xl * r);
+      laml = a * (1.0 + a / 2.0);
+      a = (xr - fm) / (xr * q);
+      lamr = a * (1.0 + a / 2.0);
+      p2 = p1 * (1.0 + 2.0 * c);
+      p3 = p2 + c / laml;
+      p4 = p3 + c / lamr;
+      nrq = np * q;
+    }
+  }
+
+  int inversion(random_64bit_generator& rng) const {
+    int n = _param.t();
+    for (;;) {
+      int x = 0;
+      double px = qn;
+      double u = rng.uniform01();
+      while (u > px) {
+        ++x;
+        if (x > bound)
+          break;
+        u -= px;
+        px = ((n - x + 1) * r * px) / (x * q);
+      }
+      if (x <= bound)
+        return x;
+    }
+  }
+
+  // Stirling-series correction used in the final acceptance test
+  static double stirling(double x) {
+    double x2 = x * x;
+    return (13860. - (462. - (132. - (99. - 140. / x2) / x2) / x2) / x2) / x / 166320.;
+  }
+
+  int btpe(random_64bit_generator& rng) const {
+    int n = _param.t();
+    for (;;) {
+      double u = rng.uniform01() * p4;
+      double v = rng.uniform01();
+      int y;
+      if (u <= p1) {
+        // triangular region: immediate acceptance
+        return int(std::floor(xm - p1 * v + u));
+      } else if (u <= p2) {
+        // parallelograms
+        double x = xl + (u - p1) / c;
+        v = v * c + 1.0 - std::abs(m - x + 0.5) / p1;
+        if (v > 1.0)
+          continue;
+        y = int(std::floor(x));
+      } else if (u <= p3) {
+        // left exponential tail
+        if (v == 0.0)
+          continue;
+        double x = std::floor(xl + std::log(v) / laml);
+        if (x < 0.0)
+          continue;
+        y = int(x);
+        v = v * (u - p2) * laml;
+      } else {
+        // right exponential tail
+        if (v == 0.0)
+          continue;
+        double x = std::floor(xr - std::log(v) / lamr);
+        if (x > n)
+          continue;
+        y = int(x);
+        v = v * (u - p3) * lamr;
+      }
+
+      int k = std::abs(y - m);
+      if (k <= 20 || k >= nrq / 2.0 - 1.0) {
+        // explicit evaluation of f(y) / f(m)
+        double s = r / q;
+        double a = s * (n + 1.0);
+        double f = 1.0;
+        if (m < y) {
+          for (int i = m + 1; i <= y; ++i)
+            f *= (a / i - s);
+        } else if (m > y) {
+          for (int i = y + 1; i <= m; ++i)
+            f /= (a / i - s);
+        }
+        if (v <= f)
+          return y;
+        continue;
+      }
+
+      // squeezing using upper and lower bounds on log(f(y))
+      double rho = (k / nrq) * ((k * (k / 3.0 + 0.625) + 0.16666666666666666) / nrq + 0.5);
+      double t = -double(k) * k / (2.0 * nrq);
+      double alpha = std::log(v);
+      if (alpha < t - rho)
+        return y;
+      if (alpha > t + rho)
+        continue;
+
+      double x1 = y + 1.0;
+      double f1 = m + 1.0;
+      double z = n + 1.0 - m;
+      double w = n - y + 1.0;
+      if (alpha <= xm * std::log(f1 / x1) + (n - m + 0.5) * std::log(z / w) +
+          (y - m) * std::log(w * r / (x1 * q)) +
+          stirling(f1) + stirling(z) + stirling(x1) + stirling(w))
+        return y;
+    }
+  }
+
+public:
+  explicit binomial_distribution(int t = 1, double p = 0.5) : _param(t, p) {init();}
+  explicit binomial_distribution(const param_type& param) : _param(param) {init();}
+
+  int t() const {return _param.t();}
+  double p() const {return _param.p();}
+  param_type param() const {return _param;}
+  // the setup is only recomputed if the parameters differ from the current ones
+  void param(const param_type& param) {
+    if (param != _param) {
+      _param = param;
+      init();
+    }
+  }
+  void reset() {}
+  result_type min() const {return 0;}
+  result_type max() const {return _param.t();}
+
+  result_type operator()(random_64bit_generator& rng) const {
+    int y = use_btpe ? btpe(rng) : inversion(rng);
+    return _param.p() > 0.5 ? _param.t() - y : y;
+  }
+
+  result_type operator()(random_64bit_generator& rng, const param_type& param) {
+    this->param(param);
+    return (*this)(rng);
+  }
+};
+
+// Gamma distribution with shape alpha and scale beta using the method by
+// Marsaglia and Tsang (2000, doi:10.1145/358407.358414) on top of the Ziggurat
+// normal distribution. For alpha < 1 the boosting G(alpha) = G(alpha + 1) *
+// U^(1 / alpha) is used.
+class gamma_distribution {
+public:
+  using result_type = double;
+
+  class param_type {
+  private:
+    double _alpha;
+    double _beta;
+
+  public:
+    using distribution_type = gamma_distribution;
+
+    explicit param_type(double alpha = 1.0, double beta = 1.0) : _alpha(alpha), _beta(beta) {
+      if (!(alpha >= 0.0 && std::isfinite(alpha)))
+        throw std::invalid_argument("Gamma distribution requires finite alpha >= 0");
+      if (!(beta >= 0.0 && std::isfinite(beta)))
+        throw std::invalid_argument("Gamma distribution requires finite beta >= 0");
+    }
+
+    double alpha() const {return _alpha;}
+    double beta() const {return _beta;}
+
+    friend bool operator==(const param_type& lhs, const param_type& rhs) {
+      return lhs._alpha == rhs._alpha && lhs._beta == rhs._beta;
+    }
+    friend bool operator!=(const param_type& lhs, const param_type& rhs) {
+      return !(lhs == rhs);
+    }
+  };
+
+private:
+  param_type _param;
+  double d, c, inv_alpha;
+
+  void init() {
+    double a = _param.alpha() < 1.0 ? _param.alpha() + 1.0 : _param.alpha();
+    d = a - 1.0 / 3.0;
+    c = 1.0 / std::sqrt(9.0 * d);
+    inv_alpha = 1.0 / _param.alpha();
+  }
+
+public:
+  explicit gamma_distribution(double alpha = 1.0, double beta = 1.0) : _param(alpha, beta) {init();}
+  explicit gamma_distribution(const param_type& param) : _param(param) {init();}
+
+  double alpha() const {return _param.alpha();}
+  double beta() const {return _param.beta();}
+  param_type param() const {return _param;}
+  void param(const param_type& param) {
+    if (param != _param) {
+      _param = param;
+      init();
+    }
+  }
+  void reset() {}
+  result_type min() const {return 0.0;}
+  result_type max() const {return INFINITY;}
+
+  result_type operator()(random_64bit_generator& rng) const {
+    if (_param.alpha() == 0.0)
+      return 0.0;
+    standard_normal_distribution normal;
+    double x, v;
+    for (;;) {
+      do {
+        x = normal(rng);
+        v = 1.0 + c * x;
+      } while (v <= 0.0);
+      v = v * v * v;
+      double u = rng.uniform01();
+      double x2 = x * x;
+      if (u < 1.0 - 0.0331 * x2 * x2 || std::log(u) < 0.5 * x2 + d * (1.0 - v + std::log(v)))
+        break;
+    }
+    double g = d * v;
+    if (_param.alpha() < 1.0) {
+      // uniform number in (0, 1]
+      double u = 1.0 - rng.uniform01();
+      g *= std::pow(u, inv_alpha);
+    }
+    return g * _param.beta();
+  }
+
+  result_type operator()(random_64bit_generator& rng, const param_type& param) {
+    this->param(param);
+    return (*this)(rng);
+  }
+};
+
+// Geometric distribution counting the failures before the first success,
+// using a single logarithm per draw: floor(log(U) / log(1 - p)) with U
+// uniformly distributed in (0, 1]. The result is returned as double since it
+// can exceed the range of int for small p.
+class geometric_distribution {
+public:
+  using result_type = double;
+
+  class param_type {
+  private:
+    double _p;
+
+  public:
+    using distribution_type = geometric_distribution;
+
+    explicit param_type(double p = 0.5) : _p(p) {
+      if (!(p > 0.0 && p <= 1.0))
+        throw std::invalid_argument("Geometric distribution requires 0 < p <= 1");
+    }
+
+    double p() const {return _p;}
+
+    friend bool operator==(const param_type& lhs, const param_type& rhs) {
+      return lhs._p == rhs._p;
+    }
+    friend bool operator!=(const param_type& lhs, const param_type& rhs) {
+      return !(lhs == rhs);
+    }
+  };
+
+private:
+  param_type _param;
+  double inv_log_q;
+
+  void init() {
+    inv_log_q = 1.0 / std::log1p(-_param.p());
+  }
+
+public:
+  explicit geometric_distribution(double p = 0.5) : _param(p) {init();}
+  explicit geometric_distribution(const param_type& param) : _param(param) {init();}
+
+  double p() const {return _param.p();}
+  param_type param() const {return _param;}
+  void param(const param_type& param) {
+    if (param != _param) {
+      _param = param;
+      init();
+    }
+  }
+  void reset() {}
+  result_type min() const {return 0.0;}
+  result_type max() const {return INFINITY;}
+
+  result_type operator()(random_64bit_generator& rng) const {
+    if (_param.p() == 1.0)
+      return 0.0;
+    double u = ((rng() >> 11) + 1) * 0x1.0p-53;
+    return std::floor(std::log(u) * inv_log_q);
+  }
+
+  result_type operator()(random_64bit_generator& rng, const param_type& param) {
+    this->param(param);
+    return (*this)(rng);
+  }
+};
+
+// Call f(k) in increasing order for the indices k in [0, n) of successful
+// trials in a sequence of n independent Bernoulli(p) trials. Instead of one
+// trial per index the gaps between successes are drawn from the geometric
+// distribution, so the cost is proportional to the number of successes. The
+// indices are passed as double, which is exact for n <= 2^53.
+template<typename Function>
+void for_each_bernoulli_index(random_64bit_generator& rng, double n, double p, Function f) {
+  if (!(p >= 0.0 && p <= 1.0))
+    throw std::invalid_argument("Bernoulli trials require 0 <= p <= 1");
+  if (n > 0x1.0p53)
+    throw std::invalid_argument("Bernoulli trials support at most 2^53 trials");
+  if (p == 0.0)
+    return;
+  geometric_distribution skip(p);
+  for (double k = skip(rng); k < n; k += skip(rng) + 1.0)
+    f(k);
+}
+
+// Negative binomial distribution counting the failures before the size-th
+// success as gamma-Poisson mixture: lambda ~ Gamma(size, (1 - p) / p) and
+// X ~ Poisson(lambda), using the PTRD algorithm from boost.random for the
+// Poisson distribution. The result is returned as double.
+class negative_binomial_distribution {
+public:
+  using result_type = double;
+
+  class param_type {
+  private:
+    double _size;
+    double _p;
+
+  public:
+    using distribution_type = negative_binomial_distribution;
+
+    explicit param_type(double size = 1.0, double p = 0.5) : _size(size), _p(p) {
+      if (!(size >= 0.0 && std::isfinite(size)))
+        throw std::invalid_argument("Negative binomial distribution requires finite size >= 0");
+      if (!(p >= 0.0 && p <= 1.0) || (p == 0.0 && size > 0.0))
+        throw std::invalid_argument("Negative binomial distribution requires 0 < p <= 1");
+    }
+
+    double size() const {return _size;}
+    double p() const {return _p;}
+
+    friend bool operator==(const param_type& lhs, const param_type& rhs) {
+      return lhs._size == rhs._size && lhs._p == rhs._p;
+    }
+    friend bool operator!=(const param_type& lhs, const param_type& rhs) {
+      return !(lhs == rhs);
+    }
+  };
+
+private:
+  param_type _param;
+  gamma_distribution gamma;
+
+  static double scale(const param_type& param) {
+    return param.p() > 0.0 ? (1.0 - param.p()) / param.p() : 0.0;
+  }
+
+public:
+  explicit negative_binomial_distribution(double size = 1.0, double p = 0.5) :
+    _param(size, p), gamma(_param.size(), scale(_param)) {}
+  explicit negative_binomial_distribution(const param_type& param) :
+    _param(param), gamma(_param.size(), scale(_param)) {}
+
+  double size() const {return _param.size();}
+  double p() const {return _param.p();}
+  param_type param() const {return _param;}
+  void param(const param_type& param) {
+    if (param != _param) {
+      _param = param;
+      gamma.param(gamma_distribution::param_type(_param.size(), scale(_param)));
+    }
+  }
+  void reset() {}
+  result_type min() const {return 0.0;}
+  result_type max() const {return INFINITY;}
+
+  result_type operator()(random_64bit_generator& rng) const {
+    double lambda = gamma(rng);
+    if (lambda <= 0.0)
+      return 0.0;
+    return double(boost::random::poisson_distribution<int64_t, double>(lambda)(rng));
+  }
+
+  result_type operator()(random_64bit_generator& rng, const param_type& param) {
+    this->param(param);
+    return (*this)(rng);
+  }
+};
+
+// Zipf distribution on {1, ..., N} with P(k) proportional to k^-s using the
+// rejection-inversion method by Hörmann and Derflinger (1996,
+// doi:10.1145/235025.235029). The hat function is the integral of x^-s, so no
+// table of size N is needed and each draw takes O(1) expected time. The
+// constants of the hat function only depend on the parameters and are cached.
+// The result is returned as double since N can exceed the range of int.
+class zipf_distribution {
+public:
+  using result_type = double;
+
+  class param_type {
+  private:
+    double _N;
+    double _s;
+
+  public:
+    using distribution_type = zipf_distribution;
+
+    explicit param_type(double N = 1.0, double s = 1.0) : _N(N), _s(s) {
+      if (!(N >= 1.0 && N <= 0x1.0p53 && N == std::floor(N) && s >= 0.0 && std::isfinite(s)))
+        throw std::invalid_argument("Zipf distribution requires integer 1 <= N <= 2^53 and finite s >= 0");
+    }
+
+    double N() const {return _N;}
+    double s() const {return _s;}
+
+    friend bool operator==(const param_type& lhs, const param_type& rhs) {
+      return lhs._N == rhs._N && lhs._s == rhs._s;
+    }
+    friend bool operator!=(const param_type& lhs, const param_type& rhs) {
+      return !(lhs == rhs);
+    }
+  };
+
+private:
+  param_type _param;
+  double h_integral_x1;
+  double h_integral_N;
+  double squeeze;
+
+  // log1p(x) / x and expm1(x) / x with their Taylor series close to zero
+  static double helper1(double x) {
+    return std::fabs(x) > 1e-8 ? std::log1p(x) / x : 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+  }
+  static double helper2(double x) {
+    return std::fabs(x) > 1e-8 ? std::expm1(x) / x : 1.0 + x * 0.5 * (1.0 + x / 3.0 * (1.0 + 0.25 * x));
+  }
+  // h(x) = x^-s, H(x) = (x^(1 - s) - 1) / (1 - s) and its inverse
+  double h(double x) const {
+    return std::exp(-_param.s() * std::log(x));
+  }
+  double h_integral(double x) const {
+    double log_x = std::log(x);
+    return helper2((1.0 - _param.s()) * log_x) * log_x;
+  }
+  double h_integral_inverse(double x) const {
+    double t = x * (1.0 - _param.s());
+    if (t < -1.0)
+      t = -1.0;
+    return std::exp(helper1(t) * x);
+  }
+
+  void init() {
+    h_integral_x1 = h_integral(1.5) - 1.0;
+    h_integral_N = h_integral(_param.N() + 0.5);
+    squeeze = 2.0 - h_integral_inverse(h_integral(2.5) - h(2.0));
+  }
+
+public:
+  explicit zipf_distribution(double N = 1.0, double s = 1.0) : _param(N, s) {init();}
+  explicit zipf_distribution(const param_type& param) : _param(param) {init();}
+
+  double N() const {return _param.N();}
+  double s() const {return _param.s();}
+  param_type param() const {return _param;}
+  void param(const param_type& param) {
+    if (param != _param) {
+      _param = param;
+      init();
+    }
+  }
+  void reset() {}
+  result_type min() const {return 1.0;}
+  result_type max() const {return _param.N();}
+
+  result_type operator()(random_64bit_generator& rng) const {
+    while (true) {
+      double u = h_integral_N + rng.uniform01() * (h_integral_x1 - h_integral_N);
+      double x = h_integral_inverse(u);
+      double k = std::floor(x + 0.5);
+      if (k < 1.0)
+        k = 1.0;
+      else if (k > _param.N())
+        k = _param.N();
+      if (k - x <= squeeze || u >= h_integral(k + 0.5) - h(k))
+        return k;
+    }
+  }
+
+  result_type operator()(random_64bit_generator& rng, const param_type& param) {
+    this->param(param);
+    return (*this)(rng);
+  }
+};
+
+// Hypergeometric distribution for the number of white balls when drawing k
+// balls without replacement from an urn with m white and n black balls. Uses
+// inversion when the mode is close to the lower bound and the H2PE algorithm
+// from Kachitvichyanukul and Schmeiser (1985, doi:10.1080/00949658508810839)
+// otherwise. As for the binomial distribution, the setup is cached and only
+// recomputed when the parameters change.
+class hypergeometric_distribution {
+public:
+  using result_type = int64_t;
+
+  class param_type {
+  private:
+    int64_t _m;
+    int64_t _n;
+    int64_t _k;
+
+  public:
+    using distribution_type = hypergeometric_distribution;
+
+    explicit param_type(int64_t m = 1, int64_t n = 1, int64_t k = 1) : _m(m), _n(n), _k(k) {
+      if (!(m >= 0 && n >= 0))
+        throw std::invalid_argument("Hypergeometric distribution requires m >= 0 and n >= 0");
+      if (!(k >= 0 && k <= m + n))
+        throw std::invalid_argument("Hypergeometric distribution requires 0 <= k <= m + n");
+    }
+
+    int64_t m() const {return _m;}
+    int64_t n() const {return _n;}
+    int64_t k() const {return _k;}
+
+    friend bool operator==(const param_type& lhs, const param_type& rhs) {
+      return lhs._m == rhs._m && lhs._n == rhs._n && lhs._k == rhs._k;
+    }
+    friend bool operator!=(const param_type& lhs, const param_type& rhs) {
+      return !(lhs == rhs);
+    }
+  };
+
+private:
+  param_type _param;
+  // urn with n1 <= n2 and sample size kk <= (n1 + n2) / 2
+  int64_t n1, n2, kk, mode, minjx, maxjx;
+  bool use_h2pe;
+  // inversion
+  double w;
+  // H2PE
+  double a, xl, xr, lamdl, lamdr, p1, p2, p3;
+
+  // log(i!)
+  static double afc(int64_t i) {
+    static const double al[8] = {
+      0.0, 0.0,
+      0.69314718055994530941723212145817,
+      1.79175946922805500081247735838070,
+      3.17805383034794561964694160129705,
+      4.78749174278204599424770093452324,
+      6.57925121201010099506017829290394,
+      8.52516136106541430016553103634712
+    };
+    if (i < 0)
+      return 0.0;
+    if (i <= 7)
+      return al[i];
+    double di = double(i);
+    double i2 = di * di;
+    return (di + 0.5) * std::log(di) - di + 0.918938533204672741780329736406 +
+      (0.0833333333333333 - 0.00277777777777778 / i2) / di;
+  }
+
+  void init() {
+    int64_t tn = _param.m() + _param.n();
+    n1 = std::min(_param.m(), _param.n());
+    n2 = std::max(_param.m(), _param.n());
+    kk = 2 * _param.k() >= tn ? tn - _param.k() : _param.k();
+    mode = int64_t((kk + 1.0) * (n1 + 1.0) / (tn + 2.0));
+    minjx = std::max(int64_t(0), kk - n2);
+    maxjx = std::min(n1, kk);
+    use_h2pe = mode - minjx >= 10;
+    if (!use_h2pe) {
+      // probability of minjx
+      if (kk < n2)
+        w = std::exp(afc(n2) + afc(tn - kk) - afc(n2 - kk) - afc(tn));
+      else
+        w = std::exp(afc(n1) + afc(kk) - afc(kk - n2) - afc(tn));
+    } else {
+      double s = std::sqrt(double(tn - kk) * kk * n1 * n2 / (tn - 1.0) / tn / tn);
+      double d = int64_t(1.5 * s) + 0.5;
+      xl = mode - d + 0.5;
+      xr = mode + d + 0.5;
+      a = afc(mode) + afc(n1 - mode) + afc(kk - mode) + afc(n2 - kk + mode);
+      double kl = std::exp(a - afc(int64_t(xl)) - afc(int64_t(n1 - xl)) -
+                           afc(int64_t(kk - xl)) - afc(int64_t(n2 - kk + xl)));
+      double kr = std::exp(a - afc(int64_t(xr - 1)) - afc(int64_t(n1 - xr + 1)) -
+                           afc(int64_t(kk - xr + 1)) - afc(int64_t(n2 - kk + xr - 1)));
+      lamdl = -std::log(xl * (n2 - kk + xl) / (n1 - xl + 1.0) / (kk - xl + 1.0));
+      lamdr = -std::log((n1 - xr + 1.0) * (kk - xr + 1.0) / xr / (n2 - kk + xr));
+      p1 = d + d;
+      p2 = p1 + kl / lamdl;
+      p3 = p2 + kr / lamdr;
+    }
+  }
+
+  int64_t inversion(random_64bit_generator& rng) const {
+    for (;;) {
+      double p = w;
+      int64_t ix = minjx;
+      double u = rng.uniform01();
+      while (u > p) {
+        u -= p;
+        p *= double(n1 - ix) * double(kk - ix);
+        ++ix;
+        p = p / ix / double(n2 - kk + ix);
+        if (ix > maxjx || p == 0.0)
+          break;
+      }
+      if (u <= p)
+        return ix;
+    }
+  }
+
+  int64_t h2pe(random_64bit_generator& rng) const {
+    const double deltal = 0.0078;
+    const double deltau = 0.0034;
+    for (;;) {
+      double u = rng.uniform01() * p3;
+      double v = rng.uniform01();
+      int64_t ix;
+      if (u < p1) {
+        // rectangular region
+        ix = int64_t(xl + u);
+      } else if (u <= p2) {
+        // left tail
+        double x = xl + std::log(v) / lamdl;
+        if (x < minjx)
+          continue;
+        ix = int64_t(x);
+        v = v * (u - p1) * lamdl;
+      } else {
+        // right tail
+        double x = xr - std::log(v) / lamdr;
+        if (x >= maxjx + 1.0)
+          continue;
+        ix = int64_t(x);
+        v = v * (u - p2) * lamdr;
+      }
+
+      if (mode < 100 || ix <= 50) {
+        // explicit evaluation of f(ix) / f(mode)
+        double f = 1.0;
+        if (mode < ix) {
+          for (int64_t i = mode + 1; i <= ix; ++i)
+            f = f * double(n1 - i + 1) * double(kk - i + 1) / double(n2 - kk + i) / double(i);
+        } else if (mode > ix) {
+          for (int64_t i = ix + 1; i <= mode; ++i)
+            f = f * double(i) * double(n2 - kk + i) / double(n1 - i + 1) / double(kk - i + 1);
+        }
+        if (v <= f)
+          return ix;
+        continue;
+      }
+
+      // squeeze using upper and lower bounds
+      double y = ix;
+      double y1 = y + 1.0;
+      double ym = y - mode;
+      double yn = n1 - y + 1.0;
+      double yk = kk - y + 1.0;
+      double nk = n2 - kk + y1;
+      double r = -ym / y1;
+      double s = ym / yn;
+      double t = ym / yk;
+      double e = -ym / nk;
+      double g = yn * yk / (y1 * nk) - 1.0;
+      double dg = g < 0.0 ? 1.0 + g : 1.0;
+      double gu = g * (1.0 + g * (-0.5 + g / 3.0));
+      double gl = gu - 0.25 * (g * g * g * g) / dg;
+      double xm = mode + 0.5;
+      double xn = n1 - mode + 0.5;
+      double xk = kk - mode + 0.5;
+      double nm = n2 - kk + xm;
+      double ub = y * gu - mode * gl + deltau +
+        xm * r * (1.0 + r * (-0.5 + r / 3.0)) +
+        xn * s * (1.0 + s * (-0.5 + s / 3.0)) +
+        xk * t * (1.0 + t * (-0.5 + t / 3.0)) +
+        nm * e * (1.0 + e * (-0.5 + e / 3.0));
+      double alv = std::log(v);
+      if (alv > ub)
+        continue;
+      double dr = xm * (r * r * r * r);
+      if (r < 0.0)
+        dr /= (1.0 + r);
+      double ds = xn * (s * s * s * s);
+      if (s < 0.0)
+        ds /= (1.0 + s);
+      double dt = xk * (t * t * t * t);
+      if (t < 0.0)
+        dt /= (1.0 + t);
+      double de = nm * (e * e * e * e);
+      if (e < 0.0)
+        de /= (1.0 + e);
+      if (alv < ub - 0.25 * (dr + ds + dt + de) + (y + mode) * (gl - gu) - deltal)
+        return ix;
+      // Stirling's formula to machine accuracy
+      if (alv <= a - afc(ix) - afc(n1 - ix) - afc(kk - ix) - afc(n2 - kk + ix))
+        return ix;
+    }
+  }
+
+public:
+  explicit hypergeometric_distribution(int64_t m = 1, int64_t n = 1, int64_t k = 1) : _param(m, n, k) {init();}
+  explicit hypergeometric_distribution(const param_type& param) : _param(param) {init();}
+
+  int64_t m() const {return _param.m();}
+  int64_t n() const {return _param.n();}
+  int64_t k() const {return _param.k();}
+  param_type param() const {return _param;}
+  void param(const param_type& param) {
+    if (param != _param) {
+      _param = param;
+      init();
+    }
+  }
+  void reset() {}
+  result_type min() const {return std::max(int64_t(0), _param.k() - _param.n());}
+  result_type max() const {return std::min(_param.m(), _param.k());}
+
+  result_type operator()(random_64bit_generator& rng) const {
+    int64_t ix;
+    if (minjx == maxjx)
+      ix = maxjx;
+    else
+      ix = use_h2pe ? h2pe(rng) : inversion(rng);
+    // undo the symmetry transformations
+    if (2 * _param.k() >= _param.m() + _param.n()) {
+      if (_param.m() > _param.n())
+        ix = _param.k() - _param.n() + ix;
+      else
+        ix = _param.m() - ix;
+    } else {
+      if (_param.m() > _param.n())
+        ix = _param.k() - ix;
+    }
+    return ix;
+  }
+
+  result_type operator()(random_64bit_generator& rng, const param_type& param) {
+    this->param(param);
+    return (*this)(rng);
+  }
+};
+
+// Multivariate hypergeometric distribution for the number of balls of each of
+// K colors when drawing k balls without replacement. The counts are drawn
+// color by color from univariate hypergeometric distributions for the balls
+// not yet drawn, so only O(K) memory is needed.
+class multivariate_hypergeometric_distribution {
+public:
+  using result_type = int64_t;
+
+private:
+  int64_t _k;
+  std::vector<int64_t> _m;
+  int64_t total;
+
+public:
+  template<typename InputIt>
+  multivariate_hypergeometric_distribution(InputIt first, InputIt last, int64_t k) : _k(k), _m(first, last), total(0) {
+    if (_m.empty())
+      throw std::invalid_argument("Multivariate hypergeometric distribution requires at least one color");
+    for (int64_t m : _m) {
+      if (!(m >= 0))
+        throw std::invalid_argument("Multivariate hypergeometric distribution requires non-negative counts");
+      total += m;
+    }
+    if (!(k >= 0 && k <= total))
+      throw std::invalid_argument("Multivariate hypergeometric distribution requires 0 <= k <= sum(m)");
+  }
+
+  int64_t k() const {return _k;}
+  std::size_t categories() const {return _m.size();}
+
+  // writes categories() counts starting at 'out'
+  template<typename OutputIt>
+  void operator()(random_64bit_generator& rng, OutputIt out) const {
+    int64_t remaining = _k;
+    int64_t left = total;
+    std::size_t i = 0;
+    std::size_t last = _m.size() - 1;
+    for (; i < last && remaining > 0; ++i, ++out) {
+      left -= _m[i];
+      int64_t count = hypergeometric_distribution(_m[i], left, remaining)(rng);
+      *out = count;
+      remaining -= count;
+    }
+    *out = remaining;
+    for (++i, ++out; i <= last; ++i, ++out)
+      *out = 0;
+  }
+};
+
+// Multinomial distribution using the conditional binomial method: the count
+// for each category is drawn from a binomial distribution for the trials not
+// yet assigned, with the probability conditioned on the remaining categories.
+// The conditional probabilities are computed once per distribution object,
+// and all categories after the last trial has been assigned are set to zero.
+class multinomial_distribution {
+public:
+  using result_type = int;
+
+private:
+  int _size;
+  std::vector<double> _cond;
+
+public:
+  template<typename InputIt>
+  multinomial_distribution(int size, InputIt first, InputIt last) : _size(size), _cond(first, last) {
+    if (!(size >= 0))
+      throw std::invalid_argument("Multinomial distribution requires size >= 0");
+    if (_cond.empty())
+      throw std::invalid_argument("Multinomial distribution requires at least one category");
+    double tail = 0.0;
+    for (auto it = _cond.rbegin(); it != _cond.rend(); ++it) {
+      double p = *it;
+      if (!(p >= 0.0 && std::isfinite(p)))
+        throw std::invalid_argument("Multinomial distribution requires finite and non-negative probabilities");
+      tail += p;
+      *it = tail > 0.0 ? std::min(p / tail, 1.0) : 0.0;
+    }
+    if (!(tail > 0.0))
+      throw std::invalid_argument("Multinomial distribution requires at least one positive probability");
+  }
+
+  int size() const {return _size;}
+  std::size_t categories() const {return _cond.size();}
+
+  // writes categories() counts starting at 'out'
+  template<typename OutputIt>
+  void operator()(random_64bit_generator& rng, OutputIt out) const {
+    int remaining = _size;
+    std::size_t k = 0;
+    std::size_t last = _cond.size() - 1;
+    for (; k < last && remaining > 0; ++k, ++out) {
+      int count = binomial_distribution(remaining, _cond[k])(rng);
+      *out = count;
+      remaining -= count;
+    }
+    *out = remaining;
+    for (++k, ++out; k <= last; ++k, ++out)
+      *out = 0;
+  }
+};
+
+// Dirichlet distribution via normalized gamma variates. If all alpha are equal
+// to one, exponential variates from the Ziggurat method are used instead. For
+// alpha < 1 the gamma variates are computed on the log scale to avoid
+// underflow. The output can be strided, e.g. for writing rows of a column
+// major matrix.
+class dirichlet_distribution {
+public:
+  using result_type = double;
+
+private:
+  std::vector<double> _alpha;
+  std::vector<gamma_distribution> gamma;
+  std::vector<double> inv_alpha;
+  bool exponential_spacings;
+  bool log_scale;
+  bool equal_alpha;
+
+public:
+  template<typename InputIt>
+  dirichlet_distribution(InputIt first, InputIt last)
+    : _alpha(first, last), exponential_spacings(true), log_scale(false), equal_alpha(true) {
+    if (_alpha.empty())
+      throw std::invalid_argument("Dirichlet distribution requires at least one category");
+    bool positive = false;
+    for (double a : _alpha) {
+      if (!(a >= 0.0 && std::isfinite(a)))
+        throw std::invalid_argument("Dirichlet distribution requires finite and non-negative alpha");
+      positive = positive || a > 0.0;
+      exponential_spacings = exponential_spacings && a == 1.0;
+      log_scale = log_scale || a < 1.0;
+      equal_alpha = equal_alpha && a == _alpha[0];
+    }
+    if (!positive)
+      throw std::invalid_argument("Dirichlet distribution requires at least one positive alpha");
+    if (exponential_spacings)
+      return;
+    // for equal alpha a single gamma distribution is shared by all categories
+    for (double a : _alpha) {
+      gamma.emplace_back(a < 1.0 ? a + 1.0 : a);
+      inv_alpha.push_back(1.0 / a);
+      if (equal_alpha)
+        break;
+    }
+  }
+
+  std::size_t categories() const {return _alpha.size();}
+
+  // writes categories() values to out[0], out[stride], out[2 * stride], ...
+  template<typename RandomIt>
+  void operator()(random_64bit_generator& rng, RandomIt out, std::ptrdiff_t stride = 1) const {
+    std::size_t K = _alpha.size();
+    double sum = 0.0;
+    if (exponential_spacings) {
+      standard_exponential_distribution exponential;
+      for (std::size_t k = 0; k < K; ++k) {
+        double e = exponential(rng);
+        out[k * stride] = e;
+        sum += e;
+      }
+    } else if (!log_scale) {
+      for (std::size_t k = 0; k < K; ++k) {
+        double g = gamma[equal_alpha ? 0 : k](rng);
+        out[k * stride] = g;
+        sum += g;
+      }
+    } else {
+      double max = -INFINITY;
+      for (std::size_t k = 0; k < K; ++k) {
+        double l;
+        if (_alpha[k] == 0.0) {
+          l = -INFINITY;
+        } else {
+          std::size_t j = equal_alpha ? 0 : k;
+          l = std::log(gamma[j](rng));
+          if (_alpha[k] < 1.0)
+            l += std::log(1.0 - rng.uniform01()) * inv_alpha[j];
+        }
+        out[k * stride] = l;
+        max = std::max(max, l);
+      }
+      for (std::size_t k = 0; k < K; ++k) {
+        double g = std::exp(out[k * stride] - max);
+        out[k * stride] = g;
+        sum += g;
+      }
+    }
+    double inv_sum = 1.0 / sum;
+    for (std::size_t k = 0; k < K; ++k)
+      out[k * stride] *= inv_sum;
+  }
+};
+
+// Wishart and inverse Wishart distribution for p x p matrices using the
+// Bartlett decomposition W = (L A) (L A)^T, where L is the Cholesky factor of
+// the scale matrix and A is lower triangular with chi-distributed diagonal
+// and standard normal entries below the diagonal. For the inverse Wishart
+// distribution with scale Psi, W is drawn with scale Psi^-1 and
+// W^-1 = (L A)^-T (L A)^-1 is computed from the inverse of the triangular
+// factor. The Cholesky factor is computed only once.
+class wishart_distribution {
+public:
+  using result_type = double;
+
+private:
+  double _df;
+  std::size_t _p;
+  bool _inverse;
+  // lower triangular Cholesky factor in column major order
+  std::vector<double> L;
+  std::vector<gamma_distribution> chi2;
+
+  // in place Cholesky decomposition of the lower triangle of a
+  static void cholesky(std::vector<double>& a, std::size_t p) {
+    for (std::size_t j = 0; j < p; ++j) {
+      double d = a[j * p + j];
+      for (std::size_t k = 0; k < j; ++k)
+        d -= a[k * p + j] * a[k * p + j];
+      if (!(d > 0.0))
+        throw std::invalid_argument("Wishart distribution requires a positive definite scale matrix");
+      d = std::sqrt(d);
+      a[j * p + j] = d;
+      for (std::size_t i = j + 1; i < p; ++i) {
+        double x = a[j * p + i];
+        for (std::size_t k = 0; k < j; ++k)
+          x -= a[k * p + i] * a[k * p + j];
+        a[j * p + i] = x / d;
+      }
+      for (std::size_t i = 0; i < j; ++i)
+        a[j * p + i] = 0.0;
+    }
+  }
+
+  // in place inverse of a lower triangular matrix
+  static void invert_lower(std::vector<double>& a, std::size_t p) {
+    for (std::size_t j = 0; j < p; ++j) {
+      a[j * p + j] = 1.0 / a[j * p + j];
+      for (std::size_t i = j + 1; i < p; ++i) {
+        double x = 0.0;
+        for (std::size_t k = j; k < i; ++k)
+          x -= a[k * p + i] * a[j * p + k];
+        a[j * p + i] = x / a[i * p + i];
+      }
+    }
+  }
+
+public:
+  template<typename InputIt>
+  wishart_distribution(double df, InputIt first, InputIt last, bool inverse = false) :
+    _df(df), _p(0), _inverse(inverse), L(first, last) {
+    _p = std::size_t(std::sqrt(double(L.size())) + 0.5);
+    if (_p == 0 || _p * _p != L.size())
+      throw std::invalid_argument("Wishart distribution requires a square scale matrix");
+    if (!(std::isfinite(df) && df > _p - 1.0))
+      throw std::invalid_argument("Wishart distribution requires finite df > p - 1");
+    cholesky(L, _p);
+    if (inverse) {
+      // Cholesky factor of the inverse scale matrix
+      invert_lower(L, _p);
+      std::vector<double> inv(_p * _p, 0.0);
+      for (std::size_t j = 0; j < _p; ++j)
+        for (std::size_t i = j; i < _p; ++i) {
+          double x = 0.0;
+          for (std::size_t k = i; k < _p; ++k)
+            x += L[i * _p + k] * L[j * _p + k];
+          inv[j * _p + i] = x;
+        }
+      L = inv;
+      cholesky(L, _p);
+    }
+    for (std::size_t i = 0; i < _p; ++i)
+      chi2.emplace_back(0.5 * (df - i), 2.0);
+  }
+
+  double df() const {return _df;}
+  std::size_t dim() const {return _p;}
+  bool inverse() const {return _inverse;}
+
+  // writes the p * p entries of a random matrix in column major order
+  template<typename RandomIt>
+  void operator()(random_64bit_generator& rng, RandomIt out) const {
+    std::size_t p = _p;
+    // Bartlett factor A
+    standard_normal_distribution normal;
+    std::vector<double> A(p * p, 0.0);
+    for (std::size_t j = 0; j < p; ++j) {
+      A[j * p + j] = std::sqrt(chi2[j](rng));
+      for (std::size_t i = j + 1; i < p; ++i)
+        A[j * p + i] = normal(rng);
+    }
+    // T = L A is lower triangular
+    std::vector<double> T(p * p, 0.0);
+    for (std::size_t j = 0; j < p; ++j)
+      for (std::size_t i = j; i < p; ++i) {
+        double x = 0.0;
+        for (std::size_t k = j; k <= i; ++k)
+          x += L[k * p + i] * A[j * p + k];
+        T[j * p + i] = x;
+      }
+    if (!_inverse) {
+      // W = T T^T
+      for (std::size_t j = 0; j < p; ++j)
+        for (std::size_t i = j; i < p; ++i) {
+          double x = 0.0;
+          for (std::size_t k = 0; k <= j; ++k)
+            x += T[k * p + i] * T[k * p + j];
+          out[j * p + i] = x;
+          out[i * p + j] = x;
+        }
+    } else {
+      // W^-1 = T^-T T^-1
+      invert_lower(T, p);
+      for (std::size_t j = 0; j < p; ++j)
+        for (std::size_t i = j; i < p; ++i) {
+          double x = 0.0;
+          for (std::size_t k = i; k < p; ++k)
+            x += T[i * p + k] * T[j * p + k];
+          out[j * p + i] = x;
+          out[i * p + j] = x;
+        }
+    }
+  }
+};
+
+// Uniformly distributed points on the unit sphere in d dimensions via
+// normalized standard normal vectors. As for the Dirichlet distribution, the
+// output can be strided.
+class sphere_distribution {
+public:
+  using result_type = double;
+
+private:
+  std::size_t _d;
+
+public:
+  explicit sphere_distribution(std::size_t d) : _d(d) {
+    if (d == 0)
+      throw std::invalid_argument("Sphere distribution requires d > 0");
+  }
+
+  std::size_t dim() const {return _d;}
+
+  // writes dim() values to out[0], out[stride], out[2 * stride], ...
+  template<typename RandomIt>
+  void operator()(random_64bit_generator& rng, RandomIt out, std::ptrdiff_t stride = 1, double radius = 1.0) const {
+    standard_normal_distribution normal;
+    double norm2;
+    do {
+      norm2 = 0.0;
+      for (std::size_t k = 0; k < _d; ++k) {
+        double z = normal(rng);
+        out[k * stride] = z;
+        norm2 += z * z;
+      }
+    } while (!(norm2 > 0.0));
+    double scale = radius / std::sqrt(norm2);
+    for (std::size_t k = 0; k < _d; ++k)
+      out[k * stride] *= scale;
+  }
+};
+
+// Uniformly distributed points in the unit ball in d dimensions. A point on
+// the sphere is scaled with the radius U^(1 / d).
+class ball_distribution {
+public:
+  using result_type = double;
+
+private:
+  sphere_distribution sphere;
+  double inv_d;
+
+public:
+  explicit ball_distribution(std::size_t d) : sphere(d), inv_d(1.0 / d) {}
+
+  std::size_t dim() const {return sphere.dim();}
+
+  template<typename RandomIt>
+  void operator()(random_64bit_generator& rng, RandomIt out, std::ptrdiff_t stride = 1) const {
+    double radius = std::pow(rng.uniform01(), inv_d);
+    sphere(rng, out, stride, radius);
+  }
+};
+
+// Uniformly distributed points on the standard simplex {x >= 0, sum(x) = 1}
+// in d dimensions via normalized exponential spacings.
+class simplex_distribution {
+public:
+  using result_type = double;
+
+private:
+  std::size_t _d;
+
+public:
+  explicit simplex_distribution(std::size_t d) : _d(d) {
+    if (d == 0)
+      throw std::invalid_argument("Simplex distribution requires d > 0");
+  }
+
+  std::size_t dim() const {return _d;}
+
+  template<typename RandomIt>
+  void operator()(random_64bit_generator& rng, RandomIt out, std::ptrdiff_t stride = 1) const {
+    standard_exponential_distribution exponential;
+    double sum = 0.0;
+    for (std::size_t k = 0; k < _d; ++k) {
+      double e = exponential(rng);
+      out[k * stride] = e;
+      sum += e;
+    }
+    double inv_sum = 1.0 / sum;
+    for (std::size_t k = 0; k < _d; ++k)
+      out[k * stride] *= inv_sum;
+  }
+};
+
+// Stratified uniform random numbers: for each stratum j, count[j] values
+// uniformly distributed in [breaks[j], breaks[j + 1]) are written to 'out'.
+// Returns the iterator past the last written value.
+template<typename OutputIt, typename BreakIt, typename CountIt>
+OutputIt generate_stratified_uniform(random_64bit_generator& rng, OutputIt out,
+                                     BreakIt bfirst, BreakIt blast, CountIt count) {
+  if (bfirst == blast)
+    return out;
+  for (BreakIt upper = std::next(bfirst); upper != blast; ++bfirst, ++upper, ++count) {
+    double lower = *bfirst;
+    double width = *upper - lower;
+    for (auto i = *count; i > 0; --i, ++out)
+      *out = lower + width * rng.uniform01();
+  }
+  return out;
+}
+
+// One column of a Latin hypercube design with n points: a random permutation
+// of the strata [i / n, (i + 1) / n) with uniform jitter within each stratum.
+// The strata are shuffled in place with the forward Fisher-Yates shuffle used
+// by dqrng::sample::no_replacement_shuffle, and each position is jittered as
+// soon as its stratum is final, so the column is written in a single pass.
+template<typename RandomIt>
+void generate_latin_hypercube_column(random_64bit_generator& rng, RandomIt first, uint32_t n) {
+  for (uint32_t i = 0; i < n; ++i)
+    first[i] = i;
+  double inv_n = 1.0 / n;
+  for (uint32_t i = 0; i < n; ++i) {
+    std::swap(first[i], first[i + rng(n - i)]);
+    first[i] = (first[i] + rng.uniform01()) * inv_n;
+  }
+}
+
+// Paths of Brownian motion X(t) = x0 + drift t + sigma W(t) at the times
+// t_i = i dt for i = 0, ..., n. By default the normal increments are drawn and
+// summed up in a single pass. Alternatively the Brownian bridge construction
+// is used: W(t_n) is drawn first and the remaining points are filled in by
+// bisection, each conditional on its already known neighbours. The bisection
+// schedule is computed once by the constructor.
+class brownian_motion_distribution {
+public:
+  using result_type = double;
+
+private:
+  struct bridge_step {
+    std::size_t mid;
+    std::size_t left;
+    std::size_t right;
+    double left_weight;
+    double right_weight;
+    double sd;
+  };
+
+  std::size_t _n;
+  double _dt;
+  double _drift;
+  double _sigma;
+  double _x0;
+  bool _bridge;
+  std::vector<bridge_step> steps;
+
+public:
+  explicit brownian_motion_distribution(std::size_t n, double dt = 1.0, double drift = 0.0,
+                                        double sigma = 1.0, double x0 = 0.0, bool bridge = false) :
+    _n(n), _dt(dt), _drift(drift), _sigma(sigma), _x0(x0), _bridge(bridge) {
+    if (!(dt > 0.0 && std::isfinite(dt) && sigma >= 0.0 && std::isfinite(sigma) &&
+        std::isfinite(drift) && std::isfinite(x0)))
+      throw std::invalid_argument("Brownian motion requires finite dt > 0, sigma >= 0, drift and x0");
+    if (!bridge || n < 2)
+      return;
+    // breadth first bisection, so that the coarse structure of the path is
+    // determined by the first random numbers
+    steps.reserve(n - 1);
+    std::vector<std::pair<std::size_t, std::size_t>> queue{{0, n}};
+    for (std::size_t q = 0; q < queue.size(); ++q) {
+      std::size_t left = queue[q].first;
+      std::size_t right = queue[q].second;
+      if (right - left < 2)
+        continue;
+      std::size_t mid = left + (right - left) / 2;
+      double width = double(right - left);
+      steps.push_back({mid, left, right, (right - mid) / width, (mid - left) / width,
+                       std::sqrt(dt * (mid - left) * (right - mid) / width)});
+      queue.emplace_back(left, mid);
+      queue.emplace_back(mid, right);
+    }
+  }
+
+  std::size_t n() const {return _n;}
+  std::size_t size() const {return _n + 1;}
+  double dt() const {return _dt;}
+  double drift() const {return _drift;}
+  double sigma() const {return _sigma;}
+  double x0() const {return _x0;}
+  bool bridge() const {return _bridge;}
+
+  // write the n + 1 points of one path to out[0], ..., out[n]
+  template<typename RandomIt>
+  void operator()(random_64bit_generator& rng, RandomIt out) const {
+    standard_normal_distribution normal;
+    if (!_bridge) {
+      double mean = _drift * _dt;
+      double sd = _sigma * std::sqrt(_dt);
+      double x = _x0;
+      out[0] = x;
+      for (std::size_t i = 1; i <= _n; ++i) {
+        x += mean + sd * normal(rng);
+        out[i] = x;
+      }
+      return;
+    }
+    out[0] = 0.0;
+    if (_n > 0)
+      out[_n] = std::sqrt(_n * _dt) * normal(rng);
+    for (const bridge_step& step : steps)
+      out[step.mid] = step.left_weight * out[step.left] + step.right_weight * out[step.right] +
+        step.sd * normal(rng);
+    for (std::size_t i = 0; i <= _n; ++i)
+      out[i] = _x0 + _drift * _dt * i + _sigma * out[i];
+  }
+};
+
+// Fill [first, last) with n sorted uniform random numbers via normalized
+// exponential spacings: U_(i) = (E_1 + ... + E_i) / (E_1 + ... + E_(n + 1)).
+// The partial sums are written in a first pass and scaled in a second one.
+template<typename OutputIt>
+void generate_sorted_uniform(random_64bit_generator& rng, OutputIt first, OutputIt last) {
+  standard_exponential_distribution exponential;
+  double sum = 0.0;
+  for (OutputIt it = first; it != last; ++it) {
+    sum += exponential(rng);
+    *it = sum;
+  }
+  double inv_sum = 1.0 / (sum + exponential(rng));
+  for (OutputIt it = first; it != last; ++it)
+    *it *= inv_sum;
+}
+
+// Input iterator over n sorted uniform random numbers with O(1) memory, using
+// 1 - U_(i+1) = (1 - U_(i)) V^(1 / (n - i)) for uniform V (Bentley and Saxe,
+// 1980, doi:10.1145/355900.355907). The product is accumulated on the log
+// scale from exponential random numbers. A default constructed iterator marks
+// the end of the sequence:
+//
+//   dqrng::sorted_uniform_iterator it(rng, n), end;
+//   for (; it != end; ++it) ...
+class sorted_uniform_iterator {
+public:
+  using iterator_category = std::input_iterator_tag;
+  using value_type = double;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const double*;
+  using reference = const double&;
+
+private:
+  random_64bit_generator* rng;
+  uint64_t remaining;
+  double log_complement;
+  double value;
+
+  void next() {
+    log_complement -= standard_exponential_distribution()(*rng) / double(remaining);
+    value = -std::expm1(log_complement);
+  }
+
+public:
+  sorted_uniform_iterator() : rng(nullptr), remaining(0), log_complement(0.0), value(0.0) {}
+  sorted_uniform_iterator(random_64bit_generator& rng, uint64_t n) :
+    rng(&rng), remaining(n), log_complement(0.0), value(0.0) {
+    if (remaining > 0)
+      next();
+  }
+
+  reference operator*() const {return value;}
+  pointer operator->() const {return &value;}
+  sorted_uniform_iterator& operator++() {
+    if (--remaining > 0)
+      next();
+    return *this;
+  }
+  sorted_uniform_iterator operator++(int) {
+    sorted_uniform_iterator tmp(*this);
+    ++*this;
+    return tmp;
+  }
+
+  friend bool operator==(const sorted_uniform_iterator& lhs, const sorted_uniform_iterator& rhs) {
+    return lhs.remaining == rhs.remaining;
+  }
+  friend bool operator!=(const sorted_uniform_iterator& lhs, const sorted_uniform_iterator& rhs) {
+    return !(lhs == rhs);
+  }
+};
+
+// Haar distributed random orthogonal d x d matrices via the Householder QR
+// decomposition of a matrix with standard normal entries. Multiplying Q with
+// the signs of the diagonal of R makes the result uniformly distributed
+// (Mezzadri, 2007, arXiv:math-ph/0609050). For rotations the sign of the first
+// column is flipped if the determinant is negative.
+class orthogonal_matrix_distribution {
+public:
+  using result_type = double;
+
+private:
+  std::size_t _d;
+  bool _rotation;
+
+public:
+  explicit orthogonal_matrix_distribution(std::size_t d, bool rotation = false) : _d(d), _rotation(rotation) {
+    if (d == 0)
+      throw std::invalid_argument("Orthogonal matrix distribution requires d > 0");
+  }
+
+  std::size_t dim() const {return _d;}
+  bool rotation() const {return _rotation;}
+
+  // writes the d * d entries of a random matrix in column major order
+  template<typename RandomIt>
+  void operator()(random_64bit_generator& rng, RandomIt out) const {
+    std::size_t d = _d;
+    standard_normal_distribution normal;
+    std::vector<double> A(d * d);
+    for (double& a : A)
+      a = normal(rng);
+    // Householder QR: the reflection vectors are stored in place of A
+    std::vector<double> tau(d, 0.0);
+    std::vector<double> sign(d, 1.0);
+    bool negative = false;
+    for (std::size_t k = 0; k < d; ++k) {
+      double* v = &A[k * d + k];
+      double norm2 = 0.0;
+      for (std::size_t i = 0; i < d - k; ++i)
+        norm2 += v[i] * v[i];
+      double alpha = v[0] >= 0.0 ? -std::sqrt(norm2) : std::sqrt(norm2);
+      // diagonal entry of R is alpha
+      if (alpha < 0.0) {
+        sign[k] = -1.0;
+        negative = !negative;
+      }
+      double x0 = v[0];
+      v[0] -= alpha;
+      double vnorm2 = norm2 - x0 * x0 + v[0] * v[0];
+      if (!(vnorm2 > 0.0))
+        continue;
+      tau[k] = 2.0 / vnorm2;
+      negative = !negative;
+      for (std::size_t j = k + 1; j < d; ++j) {
+        double* a = &A[j * d + k];
+        double dot = 0.0;
+        for (std::size_t i = 0; i < d - k; ++i)
+          dot += v[i] * a[i];
+        dot *= tau[k];
+        for (std::size_t i = 0; i < d - k; ++i)
+          a[i] -= dot * v[i];
+      }
+    }
+    // Q = H_0 H_1 ... H_{d-1} diag(sign)
+    for (std::size_t j = 0; j < d; ++j)
+      for (std::size_t i = 0; i < d; ++i)
+        out[j * d + i] = i == j ? sign[j] : 0.0;
+    for (std::size_t k = d; k-- > 0; ) {
+      if (tau[k] == 0.0)
+        continue;
+      const double* v = &A[k * d + k];
+      for (std::size_t j = 0; j < d; ++j) {
+        double dot = 0.0;
+        for (std::size_t i = 0; i < d - k; ++i)
+          dot += v[i] * out[j * d + k + i];
+        dot *= tau[k];
+        for (std::size_t i = 0; i < d - k; ++i)
+          out[j * d + k + i] -= dot * v[i];
+      }
+    }
+    if (_rotation && negative) {
+      for (std::size_t i = 0; i < d; ++i)
+        out[i] = -out[i];
+    }
+  }
+};
+
+// Normal distribution truncated to [lower, upper]. Depending on the
+// standardized interval [a, b] one of the following methods is used (cf. Li
+// and Ghosh, 2015, doi:10.1080/15598608.2014.966255):
+// * normal rejection for wide intervals containing zero,
+// * uniform rejection for narrow intervals,
+// * half-normal rejection for intervals starting close to zero,
+// * exponential rejection (Robert, 1995, doi:10.1007/BF00143942) with the
+//   optimal rate for tails.
+// Intervals below zero are mirrored. The choice of method is cached and only
+// recomputed when the parameters change.
+class truncated_normal_distribution {
+public:
+  using result_type = double;
+
+  class param_type {
+  private:
+    double _mean;
+    double _sd;
+    double _lower;
+    double _upper;
+
+  public:
+    using distribution_type = truncated_normal_distribution;
+
+    explicit param_type(double mean = 0.0, double sd = 1.0,
+                        double lower = -INFINITY, double upper = INFINITY) :
+      _mean(mean), _sd(sd), _lower(lower), _upper(upper) {
+      if (!(std::isfinite(mean) && std::isfinite(sd) && sd > 0.0))
+        throw std::invalid_argument("Truncated normal distribution requires finite mean and sd > 0");
+      if (!(lower <= upper))
+        throw std::invalid_argument("Truncated normal distribution requires lower <= upper");
+    }
+
+    double mean() const {return _mean;}
+    double sd() const {return _sd;}
+    double lower() const {return _lower;}
+    double upper() const {return _upper;}
+
+    friend bool operator==(const param_type& lhs, const param_type& rhs) {
+      return lhs._mean == rhs._mean && lhs._sd == rhs._sd &&
+        lhs._lower == rhs._lower && lhs._upper == rhs._upper;
+    }
+    friend bool operator!=(const param_type& lhs, const param_type& rhs) {
+      return !(lhs == rhs);
+    }
+  };
+
+private:
+  enum class method {point, normal, half_normal, uniform_center, uniform_tail, exponential};
+  param_type _param;
+  method _method;
+  // standardized and possibly mirrored interval
+  double a, b;
+  bool mirror;
+  // rate for exponential rejection
+  double lambda;
+
+  void init() {
+    if (_param.lower() == _param.upper()) {
+      _method = method::point;
+      return;
+    }
+    a = (_param.lower() - _param.mean()) / _param.sd();
+    b = (_param.upper() - _param.mean()) / _param.sd();
+    mirror = b <= 0.0;
+    if (mirror) {
+      double tmp = a;
+      a = -b;
+      b = -tmp;
+    }
+    // thresholds from Li and Ghosh (2015)
+    const double t1 = 0.150;
+    const double t2 = 2.18;
+    const double t3 = 0.725;
+    const double inv_sqrt_2pi = 0.398942280401432677939946059934;
+    if (a < 0.0) {
+      if (inv_sqrt_2pi * std::exp(-0.5 * a * a) <= t1 || inv_sqrt_2pi * std::exp(-0.5 * b * b) <= t1)
+        _method = method::normal;
+      else
+        _method = method::uniform_center;
+    } else if (0.5 * (b - a) * (b + a) <= std::log(t2)) {
+      _method = method::uniform_tail;
+    } else if (a < t3) {
+      _method = method::half_normal;
+    } else {
+      _method = method::exponential;
+      lambda = 0.5 * (a + std::sqrt(a * a + 4.0));
+    }
+  }
+
+  double standardized(random_64bit_generator& rng) const {
+    switch (_method) {
+    case method::normal: {
+      standard_normal_distribution normal;
+      for (;;) {
+        double z = normal(rng);
+        if (a <= z && z <= b)
+          return z;
+      }
+    }
+    case method::half_normal: {
+      standard_normal_distribution normal;
+      for (;;) {
+        double z = std::fabs(normal(rng));
+        if (a <= z && z <= b)
+          return z;
+      }
+    }
+    case method::uniform_center:
+      for (;;) {
+        double z = a + (b - a) * rng.uniform01();
+        if (rng.uniform01() <= std::exp(-0.5 * z * z))
+          return z;
+      }
+    case method::uniform_tail:
+      for (;;) {
+        double z = a + (b - a) * rng.uniform01();
+        if (rng.uniform01() <= std::exp(0.5 * (a - z) * (a + z)))
+          return z;
+      }
+    case method::exponential: {
+      exponential_distribution exponential(lambda);
+      for (;;) {
+        double z = a + exponential(rng);
+        if (z <= b && rng.uniform01() <= std::exp(-0.5 * (z - lambda) * (z - lambda)))
+          return z;
+      }
+    }
+    default:
+      return 0.0;
+    }
+  }
+
+public:
+  explicit truncated_normal_distribution(double mean = 0.0, double sd = 1.0,
+                                         double lower = -INFINITY, double upper = INFINITY) :
+    _param(mean, sd, lower, upper) {init();}
+  explicit truncated_normal_distribution(const param_type& param) : _param(param) {init();}
+
+  double mean() const {return _param.mean();}
+  double sd() const {return _param.sd();}
+  double lower() const {return _param.lower();}
+  double upper() const {return _param.upper();}
+  param_type param() const {return _param;}
+  void param(const param_type& param) {
+    if (param != _param) {
+      _param = param;
+      init();
+    }
+  }
+  void reset() {}
+  result_type min() const {return _param.lower();}
+  result_type max() const {return _param.upper();}
+
+  result_type operator()(random_64bit_generator& rng) const {
+    if (_method == method::point)
+      return _param.lower();
+    double z = standardized(rng);
+    double x = _param.mean() + _param.sd() * (mirror ? -z : z);
+    // guard against rounding at the interval boundaries
+    return std::min(std::max(x, _param.lower()), _param.upper());
+  }
+
+  result_type operator()(random_64bit_generator& rng, const param_type& param) {
+    this->param(param);
+    return (*this)(rng);
+  }
+};
+
+// Distributions that are a cheap transformation of a uniform or a normal
+// variate. A transform functor holds the parameters, validates them in its
+// constructor and maps a base variate to the target distribution. It also
+// acts as the 'param_type' of the corresponding 'transformed_distribution'.
+
+// Uniform variates in the open interval (0, 1) as needed for log() and tan()
+// The member 'antithetic' maps a base variate to its antithetic partner with
+// the same distribution.
+struct open_uniform01_base {
+  double operator()(random_64bit_generator& rng) {
+    return ((rng() >> 11) + 0.5) * 0x1.0p-53;
+  }
+  static double antithetic(double u) {return 1.0 - u;}
+};
+
+struct standard_normal_base {
+  standard_normal_distribution dist;
+  double operator()(random_64bit_generator& rng) {
+    return dist(rng);
+  }
+  static double antithetic(double z) {return -z;}
+};
+
+class normal_transform {
+private:
+  double _mean;
+  double _sd;
+
+public:
+  using base_type = standard_normal_base;
+
+  explicit normal_transform(double mean = 0.0, double sd = 1.0) : _mean(mean), _sd(sd) {
+    if (!(sd >= 0.0))
+      throw std::invalid_argument("Normal distribution requires sd >= 0");
+  }
+  double mean() const {return _mean;}
+  double sd() const {return _sd;}
+  double operator()(double z) const {return _mean + _sd * z;}
+  friend bool operator==(const normal_transform& lhs, const normal_transform& rhs) {
+    return lhs._mean == rhs._mean && lhs._sd == rhs._sd;
+  }
+  friend bool operator!=(const normal_transform& lhs, const normal_transform& rhs) {
+    return !(lhs == rhs);
+  }
+};
+
+class lognormal_transform {
+private:
+  double _meanlog;
+  double _sdlog;
+
+public:
+  using base_type = standard_normal_base;
+
+  explicit lognormal_transform(double meanlog = 0.0, double sdlog = 1.0) : _meanlog(meanlog), _sdlog(sdlog) {
+    if (!(sdlog >= 0.0))
+      throw std::invalid_argument("Lognormal distribution requires sdlog >= 0");
+  }
+  double meanlog() const {return _meanlog;}
+  double sdlog() const {return _sdlog;}
+  double operator()(double z) const {return std::exp(_meanlog + _sdlog * z);}
+  friend bool operator==(const lognormal_transform& lhs, const lognormal_transform& rhs) {
+    return lhs._meanlog == rhs._meanlog && lhs._sdlog == rhs._sdlog;
+  }
+  friend bool operator!=(const lognormal_transform& lhs, const lognormal_transform& rhs) {
+    return !(lhs == rhs);
+  }
+};
+
+class weibull_transform {
+private:
+  double _shape;
+  double _scale;
+  double inv_shape;
+
+public:
+  using base_type = open_uniform01_base;
+
+  explicit weibull_transform(double shape = 1.0, double scale = 1.0) : _shape(shape), _scale(scale), inv_shape(1.0 / shape) {
+    if (!(shape > 0.0 && scale > 0.0))
+      throw std::invalid_argument("Weibull distribution requires shape > 0 and scale > 0");
+  }
+  double shape() const {return _shape;}
+  double scale() const {return _scale;}
+  double operator()(double u) const {return _scale * std::pow(-std::log(u), inv_shape);}
+  friend bool operator==(const weibull_transform& lhs, const weibull_transform& rhs) {
+    return lhs._shape == rhs._shape && lhs._scale == rhs._scale;
+  }
+  friend bool operator!=(const weibull_transform& lhs, const weibull_transform& rhs) {
+    return !(lhs == rhs);
+  }
+};
+
+// common base for location-scale families with a uniform base variate
+class location_scale_transform {
+protected:
+  double _location;
+  double _scale;
+
+public:
+  using base_type = open_uniform01_base;
+
+  location_scale_transform(double location, double scale, const char* message) : _location(location), _scale(scale) {
+    if (!(scale >= 0.0))
+      throw std::invalid_argument(message);
+  }
+  double location() const {return _location;}
+  double scale() const {return _scale;}
+  friend bool operator==(const location_scale_transform& lhs, const location_scale_transform& rhs) {
+    return lhs._location == rhs._location && lhs._scale == rhs._scale;
+  }
+  friend bool operator!=(const location_scale_transform& lhs, const location_scale_transform& rhs) {
+    return !(lhs == rhs);
+  }
+};
+
+class uniform_transform : public location_scale_transform {
+public:
+  explicit uniform_transform(double min = 0.0, double max = 1.0) :
+    location_scale_transform(min, max - min, "Uniform distribution requires min <= max") {}
+  double min() const {return _location;}
+  double max() const {return _location + _scale;}
+  double operator()(double u) const {return _location + _scale * u;}
+};
+
+class cauchy_transform : public location_scale_transform {
+public:
+  explicit cauchy_transform(double location = 0.0, double scale = 1.0) :
+    location_scale_transform(location, scale, "Cauchy distribution requires scale >= 0") {}
+  double operator()(double u) const {
+    return _location + _scale * std::tan(3.141592653589793238462643383280 * (u - 0.5));
+  }
+};
+
+class logistic_transform : public location_scale_transform {
+public:
+  explicit logistic_transform(double location = 0.0, double scale = 1.0) :
+    location_scale_transform(location, scale, "Logistic distribution requires scale >= 0") {}
+  double operator()(double u) const {return _location + _scale * std::log(u / (1.0 - u));}
+};
+
+class gumbel_transform : public location_scale_transform {
+public:
+  explicit gumbel_transform(double location = 0.0, double scale = 1.0) :
+    location_scale_transform(location, scale, "Gumbel distribution requires scale >= 0") {}
+  double operator()(double u) const {return _location - _scale * std::log(-std::log(u));}
+};
+
+class laplace_transform : public location_scale_transform {
+public:
+  explicit laplace_transform(double location = 0.0, double scale = 1.0) :
+    location_scale_transform(location, scale, "Laplace distribution requires scale >= 0") {}
+  double operator()(double u) const {
+    double v = u - 0.5;
+    return _location - _scale * std::copysign(std::log1p(-2.0 * std::fabs(v)), v);
+  }
+};
+
+// Reduce an angle to [0, 2 pi)
+inline double wrap_angle(double x) {
+  const double two_pi = 6.283185307179586476925286766559;
+  double r = std::fmod(x, two_pi);
+  if (r < 0.0)
+    r += two_pi;
+  return r < two_pi ? r : 0.0;
+}
+
+class wrapped_normal_transform {
+private:
+  double _mu;
+  double _sd;
+
+public:
+  using base_type = standard_normal_base;
+
+  explicit wrapped_normal_transform(double mu = 0.0, double sd = 1.0) : _mu(mu), _sd(sd) {
+    if (!(std::isfinite(mu) && std::isfinite(sd) && sd >= 0.0))
+      throw std::invalid_argument("Wrapped normal distribution requires finite mu and sd >= 0");
+  }
+  double mu() const {return _mu;}
+  double sd() const {return _sd;}
+  double operator()(double z) const {return wrap_angle(_mu + _sd * z);}
+  friend bool operator==(const wrapped_normal_transform& lhs, const wrapped_normal_transform& rhs) {
+    return lhs._mu == rhs._mu && lhs._sd == rhs._sd;
+  }
+  friend bool operator!=(const wrapped_normal_transform& lhs, const wrapped_normal_transform& rhs) {
+    return !(lhs == rhs);
+  }
+};
+
+// Wrapped Cauchy distribution with concentration rho = exp(-scale) via
+// tan((theta - mu) / 2) = (1 - rho) / (1 + rho) * tan(pi * (u - 1/2))
+class wrapped_cauchy_transform {
+private:
+  double _mu;
+  double _rho;
+  double factor;
+
+public:
+  using base_type = open_uniform01_base;
+
+  explicit wrapped_cauchy_transform(double mu = 0.0, double rho = 0.5) : _mu(mu), _rho(rho), factor((1.0 - rho) / (1.0 + rho)) {
+    if (!(std::isfinite(mu) && rho >= 0.0 && rho < 1.0))
+      throw std::invalid_argument("Wrapped Cauchy distribution requires finite mu and 0 <= rho < 1");
+  }
+  double mu() const {return _mu;}
+  double rho() const {return _rho;}
+  double operator()(double u) const {
+    return wrap_angle(_mu + 2.0 * std::atan(factor * std::tan(3.141592653589793238462643383280 * (u - 0.5))));
+  }
+  friend bool operator==(const wrapped_cauchy_transform& lhs, const wrapped_cauchy_transform& rhs) {
+    return lhs._mu == rhs._mu && lhs._rho == rhs._rho;
+  }
+  friend bool operator!=(const wrapped_cauchy_transform& lhs, const wrapped_cauchy_transform& rhs) {
+    return !(lhs == rhs);
+  }
+};
+
+// Block kernel: base variates are generated into a buffer on the stack and
+// the transformation is applied in a separate loop without any dependency on
+// the RNG state, which the compiler can vectorize when vectorized math
+// functions are available. The variant with a range of transforms cycles
+// through them, which implements recycled parameter vectors. With
+// 'Antithetic' only every second base variate is drawn and followed by its
+// antithetic partner, which results in pairs like F^-1(u), F^-1(1 - u) for
+// distributions obtained by inversion. For odd lengths the last base variate
+// has no partner.
+template<typename OutputIt, typename TransformIt, std::size_t BlockSize = 256, bool Antithetic = false>
+void generate_transformed(random_64bit_generator& rng, OutputIt first, OutputIt last,
+                          TransformIt tfirst, TransformIt tlast) {
+  static_assert(BlockSize % 2 == 0, "BlockSize must be even");
+  using Transform = typename std::iterator_traits<TransformIt>::value_type;
+  using Base = typename Transform::base_type;
+  Base base;
+  double buffer[BlockSize];
+  TransformIt t = tfirst;
+  for (auto remaining = std::distance(first, last); remaining > 0; ) {
+    std::size_t block = remaining < std::ptrdiff_t(BlockSize) ? std::size_t(remaining) : BlockSize;
+    if (Antithetic) {
+      for (std::size_t i = 0; i + 1 < block; i += 2) {
+        buffer[i] = base(rng);
+        buffer[i + 1] = Base::antithetic(buffer[i]);
+      }
+      if (block % 2 == 1)
+        buffer[block - 1] = base(rng);
+    } else {
+      for (std::size_t i = 0; i < block; ++i)
+        buffer[i] = base(rng);
+    }
+    if (std::next(tfirst) == tlast) {
+      const Transform transform = *tfirst;
+      for (std::size_t i = 0; i < block; ++i)
+        buffer[i] = transform(buffer[i]);
+    } else {
+      for (std::size_t i = 0; i < block; ++i) {
+        buffer[i] = (*t)(buffer[i]);
+        if (++t == tlast)
+          t = tfirst;
+      }
+    }
+    first = std::copy(buffer, buffer + block, first);
+    remaining -= block;
+  }
+}
+
+template<typename Transform, typename OutputIt>
+void generate_transformed(random_64bit_generator& rng, OutputIt first, OutputIt last, const Transform& transform) {
+  generate_transformed(rng, first, last, &transform, &transform + 1);
+}
+
+// Antithetic variates as pairs (x_1, x_1'), (x_2, x_2'), ... written
+// consecutively to [first, last)
+template<typename OutputIt, typename TransformIt>
+void generate_antithetic(random_64bit_generator& rng, OutputIt first, OutputIt last,
+                         TransformIt tfirst, TransformIt tlast) {
+  generate_transformed<OutputIt, TransformIt, 256, true>(rng, first, last, tfirst, tlast);
+}
+
+template<typename Transform, typename OutputIt>
+void generate_antithetic(random_64bit_generator& rng, OutputIt first, OutputIt last, const Transform& transform) {
+  generate_antithetic(rng, first, last, &transform, &transform + 1);
+}
+
+// Single variate interface compatible with variate<Dist>() and generate<Dist>()
+template<typename Transform>
+class transformed_distribution {
+public:
+  using result_type = double;
+  using param_type = Transform;
+
+private:
+  param_type _param;
+  typename Transform::base_type base;
+
+public:
+  transformed_distribution() : _param() {}
+  transformed_distribution(double a, double b) : _param(a, b) {}
+  explicit transformed_distribution(const param_type& param) : _param(param) {}
+
+  param_type param() const {return _param;}
+  void param(const param_type& param) {_param = param;}
+  void reset() {}
+
+  result_type operator()(random_64bit_generator& rng) {
+    return _param(base(rng));
+  }
+
+  result_type operator()(random_64bit_generator& rng, const param_type& param) {
+    this->param(param);
+    return (*this)(rng);
+  }
+};
+
+using lognormal_distribution = transformed_distribution<lognormal_transform>;
+using weibull_distribution = transformed_distribution<weibull_transform>;
+using cauchy_distribution = transformed_distribution<cauchy_transform>;
+using logistic_distribution = transformed_distribution<logistic_transform>;
+using gumbel_distribution = transformed_distribution<gumbel_transform>;
+using laplace_distribution = transformed_distribution<laplace_transform>;
+using wrapped_normal_distribution = transformed_distribution<wrapped_normal_transform>;
+using wrapped_cauchy_distribution = transformed_distribution<wrapped_cauchy_transform>;
+
+// von Mises distribution on [0, 2 pi) using the rejection algorithm by Best
+// and Fisher (1979, doi:10.2307/2346732). Each trial uses one 64 bit random
+// number for the angle of the proposal and its sign together with one uniform
+// random number for the acceptance test. For very small kappa the uniform
+// distribution and for very large kappa the wrapped normal approximation is
+// used. The setup is cached and only recomputed when the parameters change.
+class von_mises_distribution {
+public:
+  using result_type = double;
+
+  class param_type {
+  private:
+    double _mu;
+    double _kappa;
+
+  public:
+    using distribution_type = von_mises_distribution;
+
+    explicit param_type(double mu = 0.0, double kappa = 1.0) : _mu(mu), _kappa(kappa) {
+      if (!(std::isfinite(mu) && std::isfinite(kappa) && kappa >= 0.0))
+        throw std::invalid_argument("von Mises distribution requires finite mu and kappa >= 0");
+    }
+
+    double mu() const {return _mu;}
+    double kappa() const {return _kappa;}
+
+    friend bool operator==(const param_type& lhs, const param_type& rhs) {
+      return lhs._mu == rhs._mu && lhs._kappa == rhs._kappa;
+    }
+    friend bool operator!=(const param_type& lhs, const param_type& rhs) {
+      return !(lhs == rhs);
+    }
+  };
+
+private:
+  param_type _param;
+  double s;
+
+  void init() {
+    double kappa = _param.kappa();
+    if (kappa < 1e-5) {
+      s = 1.0 / kappa + kappa;
+    } else if (kappa <= 1e6) {
+      double r = 1.0 + std::sqrt(1.0 + 4.0 * kappa * kappa);
+      double rho = (r - std::sqrt(2.0 * r)) / (2.0 * kappa);
+      s = (1.0 + rho * rho) / (2.0 * rho);
+    }
+  }
+
+public:
+  explicit von_mises_distribution(double mu = 0.0, double kappa = 1.0) : _param(mu, kappa) {init();}
+  explicit von_mises_distribution(const param_type& param) : _param(param) {init();}
+
+  double mu() const {return _param.mu();}
+  double kappa() const {return _param.kappa();}
+  param_type param() const {return _param;}
+  void param(const param_type& param) {
+    if (param != _param) {
+      _param = param;
+      init();
+    }
+  }
+  void reset() {}
+  result_type min() const {return 0.0;}
+  result_type max() const {return 6.283185307179586476925286766559;}
+
+  result_type operator()(random_64bit_generator& rng) const {
+    const double pi = 3.141592653589793238462643383280;
+    double kappa = _param.kappa();
+    if (kappa < 1e-8)
+      return wrap_angle(_param.mu() + 2.0 * pi * rng.uniform01());
+    if (kappa > 1e6)
+      return wrap_angle(_param.mu() + normal_distribution(0.0, 1.0 / std::sqrt(kappa))(rng));
+    double w;
+    uint64_t bits;
+    for (;;) {
+      // the upper 52 bits give the angle of the proposal, bit 11 its sign
+      bits = rng();
+      double z = std::cos(pi * ((bits >> 12) * 0x1.0p-52));
+      w = (1.0 + s * z) / (s + z);
+      double y = kappa * (s - w);
+      double v = rng.uniform01();
+      if (y * (2.0 - y) - v >= 0.0 || std::log(y / v) + 1.0 - y >= 0.0)
+        break;
+    }
+    double theta = std::acos(std::min(1.0, std::max(-1.0, w)));
+    if (bits & (UINT64_C(1) << 11))
+      theta = -theta;
+    return wrap_angle(_param.mu() + theta);
+  }
+
+  result_type operator()(random_64bit_generator& rng, const param_type& param) {
+    this->param(param);
+    return (*this)(rng);
+  }
+};
+
+} // namespace dqrng
+
 #endif // DQRNG_DISTRIBUTION_H
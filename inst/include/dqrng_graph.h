@@ -0,0 +1,143 @@
+// Copyright 2024 Ralf Stubner
+//
+// This file is part of dqrng.
+//
+// dqrng is free software: you can redistribute it and/or modify it
+// under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// dqrng is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with dqrng.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DQRNG_GRAPH_H
+#define DQRNG_GRAPH_H 1
+
+#include <mystdint.h>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <dqrng_types.h>
+#include <dqrng_distribution.h>
+#include <dqrng_sample.h>
+
+// Generators for random undirected graphs without loops or multiple edges on
+// the vertices 0, ..., n - 1. The edges are passed to a function f(from, to)
+// with from < to. The n (n - 1) / 2 possible edges are indexed in the order
+// used by Batagelj and Brandes (2005, doi:10.1103/PhysRevE.71.036113), i.e.
+// the edge (w, v) with w < v has index v (v - 1) / 2 + w. Since the indices
+// are handled as double in the geometric skipping, n (n - 1) / 2 must not
+// exceed 2^53.
+namespace dqrng {
+namespace graph {
+inline double number_of_pairs(double n) {
+  double pairs = n * (n - 1.0) / 2.0;
+  if (pairs > 0x1.0p53)
+    throw std::invalid_argument("Graph generators support at most 2^53 vertex pairs");
+  return pairs;
+}
+
+// edge (w, v) with w < v for the given index via combinatorial unranking
+inline std::pair<uint32_t, uint32_t> unrank_pair(uint64_t index) {
+  uint64_t v = uint64_t((1.0 + std::sqrt(1.0 + 8.0 * double(index))) / 2.0);
+  // correct for rounding errors in the square root
+  while (v * (v - 1) / 2 > index)
+    --v;
+  while ((v + 1) * v / 2 <= index)
+    ++v;
+  return std::make_pair(uint32_t(index - v * (v - 1) / 2), uint32_t(v));
+}
+
+// Erdős–Rényi graph G(n, p) where each edge is present with probability p.
+// The gaps between the present edges are drawn from the geometric
+// distribution, so the cost is proportional to n + number of edges.
+template<typename Function>
+void gnp(random_64bit_generator& rng, uint32_t n, double p, Function f) {
+  double pairs = number_of_pairs(n);
+  uint32_t v = 1;
+  double first = 0.0; // index of the edge (0, v)
+  for_each_bernoulli_index(rng, pairs, p, [&](double k) {
+    while (k >= first + v) {
+      first += v;
+      ++v;
+    }
+    f(uint32_t(k - first), v);
+  });
+}
+
+// Erdős–Rényi graph G(n, m) with m edges chosen uniformly at random. The edge
+// indices are sampled without replacement and unranked afterwards. The edges
+// are passed to f in random order.
+template<typename Function>
+void gnm(random_64bit_generator& rng, uint32_t n, uint64_t m, Function f) {
+  uint64_t pairs = uint64_t(number_of_pairs(n));
+  if (m > pairs)
+    throw std::invalid_argument("G(n, m) graph requires m <= n (n - 1) / 2");
+  if (m == 0)
+    return;
+  std::vector<uint64_t> index = sample::sample<std::vector<uint64_t>, uint64_t>(rng, pairs, m, false);
+  for (uint64_t k : index) {
+    std::pair<uint32_t, uint32_t> edge = unrank_pair(k);
+    f(edge.first, edge.second);
+  }
+}
+
+// Stochastic block model with blocks of the given sizes, where vertices in
+// blocks r and s are connected with probability prob[r + k * s] for k
+// blocks, i.e. prob is a symmetric k x k matrix in column major order. The
+// vertices of block r follow those of block r - 1. Within each pair of blocks
+// the edges are generated with geometric skipping as for G(n, p).
+template<typename Function>
+void sbm(random_64bit_generator& rng, const std::vector<uint32_t>& size,
+         const std::vector<double>& prob, Function f) {
+  std::size_t k = size.size();
+  if (prob.size() != k * k)
+    throw std::invalid_argument("Stochastic block model requires a k x k probability matrix");
+  for (std::size_t r = 0; r < k; ++r) {
+    for (std::size_t s = r + 1; s < k; ++s) {
+      if (prob[r + k * s] != prob[s + k * r])
+        throw std::invalid_argument("Stochastic block model requires a symmetric probability matrix");
+    }
+  }
+  double total = 0.0;
+  for (std::size_t r = 0; r < k; ++r)
+    total += size[r];
+  if (total > double(UINT32_MAX))
+    throw std::invalid_argument("Stochastic block model supports at most 2^32 - 1 vertices");
+  std::vector<uint32_t> offset(k);
+  uint32_t first = 0;
+  for (std::size_t r = 0; r < k; ++r) {
+    offset[r] = first;
+    first += size[r];
+  }
+  for (std::size_t s = 0; s < k; ++s) {
+    // within block s
+    uint32_t start = offset[s];
+    gnp(rng, size[s], prob[s + k * s], [&](uint32_t w, uint32_t v) {
+      f(start + w, start + v);
+    });
+    // between the earlier blocks r and block s, as size[r] x size[s] rectangle
+    for (std::size_t r = 0; r < s; ++r) {
+      double rows = size[r];
+      double pairs = rows * size[s];
+      if (pairs > 0x1.0p53)
+        throw std::invalid_argument("Graph generators support at most 2^53 vertex pairs");
+      uint32_t from = offset[r];
+      uint32_t to = start;
+      for_each_bernoulli_index(rng, pairs, prob[r + k * s], [&](double index) {
+        double col = std::floor(index / rows);
+        f(from + uint32_t(index - col * rows), to + uint32_t(col));
+      });
+    }
+  }
+}
+} // namespace graph
+} // namespace dqrng
+
+#endif // DQRNG_GRAPH_H
@@ -0,0 +1,306 @@
+// Copyright 2024 Ralf Stubner
+//
+// This file is part of dqrng.
+//
+// dqrng is free software: you can redistribute it and/or modify it
+// under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// dqrng is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with dqrng.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef DQRNG_QMC_H
+#define DQRNG_QMC_H 1
+
+#include <mystdint.h>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <boost/random/detail/sobol_table.hpp>
+#include <dqrng_types.h>
+
+namespace dqrng {
+// Sobol sequence with 32 bit resolution using the direction numbers by Joe
+// and Kuo (2008, doi:10.1137/070709359) as tabulated in boost.random for up to
+// 3667 dimensions. Consecutive points are generated with Gray code
+// increments, i.e. a single XOR per coordinate, while any index can be reached
+// in O(1) via seek(). Available randomizations, which draw all random numbers
+// from the given RNG in the constructor:
+//
+//   owen: nested uniform scrambling with the hash-based approximation by
+//         Burley (2020, https://jcgt.org/published/0009/04/01/)
+//   lms:  linear matrix scrambling with random lower triangular matrices
+//         (Matousek, 1998) followed by a random digital shift
+//
+// Scrambled points are centered within their cell of width 2^-32 and hence
+// lie in the open interval (0, 1), while the unscrambled sequence starts at 0.
+class sobol_sequence {
+public:
+  enum scrambling_type {none, owen, lms};
+  static const unsigned int bits = 32;
+  static const std::size_t max_dimension = boost::random::detail::qrng_tables::sobol::max_dimension;
+  static const uint64_t max_index = uint64_t(1) << bits;
+
+private:
+  std::size_t _dim;
+  scrambling_type _scrambling;
+  std::vector<uint32_t> direction;
+  std::vector<uint32_t> seed;
+  std::vector<uint32_t> state;
+  uint64_t _index;
+
+  static uint32_t reverse_bits(uint32_t x) {
+    x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+    x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+    x = ((x >> 4) & 0x0F0F0F0Fu) | ((x & 0x0F0F0F0Fu) << 4);
+    x = ((x >> 8) & 0x00FF00FFu) | ((x & 0x00FF00FFu) << 8);
+    return (x >> 16) | (x << 16);
+  }
+
+  static uint32_t nested_uniform_scramble(uint32_t x, uint32_t seed) {
+    x = reverse_bits(x);
+    x += seed;
+    x ^= x * 0x6c50b47cu;
+    x ^= x * 0xb82f1e52u;
+    x ^= x * 0xc7afe638u;
+    x ^= x * 0x8d22f6e6u;
+    return reverse_bits(x);
+  }
+
+  static uint32_t parity(uint32_t x) {
+    x ^= x >> 16;
+    x ^= x >> 8;
+    x ^= x >> 4;
+    x ^= x >> 2;
+    x ^= x >> 1;
+    return x & 1u;
+  }
+
+  void init_direction() {
+    using table = boost::random::detail::qrng_tables::sobol;
+    if (_dim == 0 || _dim > max_dimension)
+      throw std::invalid_argument("Sobol sequence requires 0 < dimension <= 3667");
+    direction.resize(_dim * bits);
+    std::vector<uint32_t> m(bits);
+    for (std::size_t j = 0; j < _dim; ++j) {
+      if (j == 0) {
+        std::fill(m.begin(), m.end(), 1u);
+      } else {
+        // recurrence from Bratley and Fox (1988) as in boost::random::sobol
+        uint32_t poly = table::polynomial(j - 1);
+        unsigned int degree = 0;
+        while (poly >> (degree + 1))
+          ++degree;
+        for (unsigned int k = 0; k < degree && k < bits; ++k)
+          m[k] = table::minit(j - 1, k);
+        for (unsigned int k = degree; k < bits; ++k) {
+          m[k] = m[k - degree];
+          uint32_t p = poly;
+          for (unsigned int i = 0; i < degree; ++i, p >>= 1)
+            m[k] ^= ((p & 1u) * m[k - (degree - i)]) << (degree - i);
+        }
+      }
+      for (unsigned int k = 0; k < bits; ++k)
+        direction[j * bits + k] = m[k] << (bits - 1 - k);
+    }
+  }
+
+  void init_scrambling(random_64bit_generator& rng) {
+    if (_scrambling == none)
+      return;
+    seed.resize(_dim);
+    for (std::size_t j = 0; j < _dim; ++j)
+      seed[j] = uint32_t(rng() >> 32);
+    if (_scrambling != lms)
+      return;
+    // Row r of the lower triangular matrix acts on digit r, i.e. bit 31 - r,
+    // and has random entries for the more significant digits.
+    uint32_t row[bits];
+    for (std::size_t j = 0; j < _dim; ++j) {
+      for (unsigned int r = 0; r < bits; ++r) {
+        uint32_t diagonal = uint32_t(1) << (bits - 1 - r);
+        row[r] = diagonal | (uint32_t(rng() >> 32) & ~(2 * diagonal - 1));
+      }
+      for (unsigned int k = 0; k < bits; ++k) {
+        uint32_t v = direction[j * bits + k];
+        uint32_t scrambled = 0;
+        for (unsigned int r = 0; r < bits; ++r)
+          scrambled |= parity(row[r] & v) << (bits - 1 - r);
+        direction[j * bits + k] = scrambled;
+      }
+    }
+  }
+
+  double to_double(std::size_t j) const {
+    switch (_scrambling) {
+    case owen:
+      return (nested_uniform_scramble(state[j], seed[j]) + 0.5) * 0x1.0p-32;
+    case lms:
+      return ((state[j] ^ seed[j]) + 0.5) * 0x1.0p-32;
+    default:
+      return state[j] * 0x1.0p-32;
+    }
+  }
+
+public:
+  explicit sobol_sequence(std::size_t dim) : _dim(dim), _scrambling(none), _index(0) {
+    init_direction();
+    state.assign(_dim, 0u);
+  }
+
+  sobol_sequence(std::size_t dim, random_64bit_generator& rng, scrambling_type scrambling = owen) :
+    _dim(dim), _scrambling(scrambling), _index(0) {
+    init_direction();
+    init_scrambling(rng);
+    state.assign(_dim, 0u);
+  }
+
+  std::size_t dim() const {return _dim;}
+  scrambling_type scrambling() const {return _scrambling;}
+  // index of the next point
+  uint64_t index() const {return _index;}
+
+  void seek(uint64_t index) {
+    if (index > max_index)
+      throw std::out_of_range("Sobol sequence supports at most 2^32 points");
+    _index = index;
+    uint64_t gray = index ^ (index >> 1);
+    for (std::size_t j = 0; j < _dim; ++j) {
+      uint32_t x = 0;
+      for (unsigned int k = 0; k < bits && (gray >> k) != 0; ++k) {
+        if ((gray >> k) & 1u)
+          x ^= direction[j * bits + k];
+      }
+      state[j] = x;
+    }
+  }
+
+  // write the dim coordinates of the next point to out[0], out[stride], ...
+  template<typename RandomIt>
+  void operator()(RandomIt out, std::ptrdiff_t stride = 1) {
+    if (_index >= max_index)
+      throw std::out_of_range("Sobol sequence supports at most 2^32 points");
+    for (std::size_t j = 0; j < _dim; ++j)
+      out[j * stride] = to_double(j);
+    // Gray code increment: flip the direction number for the lowest zero bit
+    ++_index;
+    if (_index == max_index)
+      return;
+    unsigned int c = 0;
+    while (((_index >> c) & 1u) == 0)
+      ++c;
+    for (std::size_t j = 0; j < _dim; ++j)
+      state[j] ^= direction[j * bits + c];
+  }
+
+  // write the next n points to the column major n x dim matrix at 'out'
+  template<typename RandomIt>
+  void generate(RandomIt out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i)
+      (*this)(out + i, std::ptrdiff_t(n));
+  }
+};
+
+// Halton sequence using the first dim primes as bases. Optionally the digits
+// in each dimension are permuted with a random permutation of 1, ..., p - 1
+// that keeps 0 fixed, so that trailing zeros remain zero (generalized Halton
+// sequence, Faure and Lemieux, 2009, doi:10.1145/1596519.1596520). Each point
+// is computed directly from its index, so seek() is O(1).
+class halton_sequence {
+private:
+  std::size_t _dim;
+  bool _permuted;
+  std::vector<uint32_t> base;
+  std::vector<std::size_t> offset;
+  std::vector<uint32_t> permutation;
+  uint64_t _index;
+
+  void init_base() {
+    if (_dim == 0)
+      throw std::invalid_argument("Halton sequence requires dimension > 0");
+    base.reserve(_dim);
+    for (uint32_t p = 2; base.size() < _dim; ++p) {
+      bool prime = true;
+      for (uint32_t q : base) {
+        if (q * q > p)
+          break;
+        if (p % q == 0) {
+          prime = false;
+          break;
+        }
+      }
+      if (prime)
+        base.push_back(p);
+    }
+  }
+
+public:
+  explicit halton_sequence(std::size_t dim) : _dim(dim), _permuted(false), _index(0) {
+    init_base();
+  }
+
+  halton_sequence(std::size_t dim, random_64bit_generator& rng) : _dim(dim), _permuted(true), _index(0) {
+    init_base();
+    offset.resize(_dim);
+    std::size_t total = 0;
+    for (std::size_t j = 0; j < _dim; ++j) {
+      offset[j] = total;
+      total += base[j];
+    }
+    permutation.resize(total);
+    for (std::size_t j = 0; j < _dim; ++j) {
+      uint32_t* perm = permutation.data() + offset[j];
+      uint32_t p = base[j];
+      for (uint32_t i = 0; i < p; ++i)
+        perm[i] = i;
+      for (uint32_t i = 1; i + 1 < p; ++i)
+        std::swap(perm[i], perm[i + rng(p - i)]);
+    }
+  }
+
+  std::size_t dim() const {return _dim;}
+  bool permuted() const {return _permuted;}
+  // index of the next point
+  uint64_t index() const {return _index;}
+  void seek(uint64_t index) {_index = index;}
+
+  // radical inverse of 'index' in dimension j
+  double point(uint64_t index, std::size_t j) const {
+    uint32_t p = base[j];
+    double inv_p = 1.0 / p;
+    double factor = inv_p;
+    double x = 0.0;
+    const uint32_t* perm = _permuted ? permutation.data() + offset[j] : nullptr;
+    while (index > 0) {
+      uint32_t digit = uint32_t(index % p);
+      x += (perm ? perm[digit] : digit) * factor;
+      index /= p;
+      factor *= inv_p;
+    }
+    return x;
+  }
+
+  // write the dim coordinates of the next point to out[0], out[stride], ...
+  template<typename RandomIt>
+  void operator()(RandomIt out, std::ptrdiff_t stride = 1) {
+    for (std::size_t j = 0; j < _dim; ++j)
+      out[j * stride] = point(_index, j);
+    ++_index;
+  }
+
+  // write the next n points to the column major n x dim matrix at 'out'
+  template<typename RandomIt>
+  void generate(RandomIt out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i)
+      (*this)(out + i, std::ptrdiff_t(n));
+  }
+};
+} // namespace dqrng
+
+#endif // DQRNG_QMC_H
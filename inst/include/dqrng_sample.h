@@ -20,11 +20,93 @@
 #define DQRNG_SAMPLE_H 1
 
 #include <mystdint.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
 #include <Rcpp.h>
 #include <dqrng_types.h>
 #include <minimal_int_set.h>
 
 namespace dqrng {
+// Alias table for sampling from a discrete distribution using Vose's method.
+// Each draw uses a single 64 bit random number: the high part of its product
+// with the number of categories selects the column, the low part is uniformly
+// distributed and compared with the column's threshold.
+template<typename INT = uint32_t>
+class alias_table {
+private:
+  std::vector<uint64_t> threshold;
+  std::vector<INT> alias;
+
+public:
+  template<typename InputIt>
+  alias_table(InputIt first, InputIt last) {
+    std::vector<double> prob(first, last);
+    std::size_t n = prob.size();
+    if (n == 0)
+      Rcpp::stop("Alias table requires at least one weight");
+    if (n - 1 > std::size_t((std::numeric_limits<INT>::max)()))
+      Rcpp::stop("Too many weights for alias table");
+    double sum = 0.0;
+    for (double p : prob) {
+      if (!(p >= 0.0 && std::isfinite(p)))
+        Rcpp::stop("Alias table requires finite and non-negative weights");
+      sum += p;
+    }
+    if (!(sum > 0.0))
+      Rcpp::stop("Alias table requires at least one positive weight");
+
+    threshold.resize(n);
+    alias.resize(n);
+    std::vector<INT> small, large;
+    for (std::size_t i = 0; i < n; ++i) {
+      prob[i] *= n / sum;
+      if (prob[i] < 1.0)
+        small.push_back(INT(i));
+      else
+        large.push_back(INT(i));
+    }
+    while (!small.empty() && !large.empty()) {
+      INT l = small.back();
+      small.pop_back();
+      INT g = large.back();
+      set_column(l, prob[l], g);
+      prob[g] = (prob[g] + prob[l]) - 1.0;
+      if (prob[g] < 1.0) {
+        large.pop_back();
+        small.push_back(g);
+      }
+    }
+    // remaining columns are full up to rounding errors
+    for (INT g : large)
+      set_column(g, 1.0, g);
+    for (INT l : small)
+      set_column(l, 1.0, l);
+  }
+
+  std::size_t size() const {return alias.size();}
+
+  INT operator()(dqrng::random_64bit_generator &rng) const {
+    using pcg_extras::pcg128_t;
+    pcg128_t m = pcg128_t(rng()) * pcg128_t(uint64_t(alias.size()));
+    INT i = INT(m >> 64);
+    return uint64_t(m) < threshold[i] ? i : alias[i];
+  }
+
+private:
+  void set_column(INT i, double p, INT a) {
+    double t = p * 0x1.0p64;
+    if (t >= 0x1.0p64) {
+      threshold[i] = UINT64_MAX;
+      alias[i] = i;
+    } else {
+      threshold[i] = uint64_t(t);
+      alias[i] = a;
+    }
+  }
+};
+
 namespace sample {
 template<typename VEC, typename INT>
 inline VEC replacement(dqrng::random_64bit_generator &rng, INT n, INT size, int offset) {
@@ -34,6 +116,62 @@ inline VEC replacement(dqrng::random_64bit_generator &rng, INT n, INT size, int
   return result;
 }
 
+template<typename VEC, typename INT, typename TINT>
+inline VEC replacement_alias(dqrng::random_64bit_generator &rng, const dqrng::alias_table<TINT> &table, INT size, int offset) {
+  VEC result(size);
+  std::generate(result.begin(), result.end(),
+                [&table, offset, &rng] () {return (offset + table(rng));});
+  return result;
+}
+
+// Weighted sampling with replacement by binary search over the cumulative
+// weights. The setup is a single pass over the weights, which makes this
+// preferable to an alias table when only few samples are drawn.
+template<typename VEC, typename INT, typename InputIt>
+inline VEC replacement_cumulative(dqrng::random_64bit_generator &rng, InputIt first, InputIt last,
+                                  INT size, int offset) {
+  std::vector<double> cumulative;
+  cumulative.reserve(std::distance(first, last));
+  double sum = 0.0;
+  for (; first != last; ++first) {
+    double p = *first;
+    if (!(p >= 0.0 && std::isfinite(p)))
+      Rcpp::stop("Weighted sampling requires finite and non-negative weights");
+    sum += p;
+    cumulative.push_back(sum);
+  }
+  if (!(sum > 0.0))
+    Rcpp::stop("Weighted sampling requires at least one positive weight");
+  VEC result(size);
+  std::generate(result.begin(), result.end(), [&cumulative, sum, offset, &rng] () {
+    while (true) {
+      double u = rng.uniform01() * sum;
+      // zero weights are never selected, since their cumulative weight equals
+      // the one of their predecessor
+      auto it = std::upper_bound(cumulative.begin(), cumulative.end(), u);
+      // u might be rounded up to sum
+      if (it != cumulative.end())
+        return offset + INT(it - cumulative.begin());
+    }
+  });
+  return result;
+}
+
+// Weighted sampling with replacement. The O(n) setup of an alias table pays
+// off for large samples, while binary search over the cumulative weights is
+// used if size log2(n) < 2 n, which is about the break-even point.
+template<typename VEC, typename INT, typename InputIt>
+inline VEC replacement_weighted(dqrng::random_64bit_generator &rng, InputIt first, InputIt last,
+                                INT size, int offset) {
+  double n = double(std::distance(first, last));
+  if (double(size) * std::log2(n) < 2.0 * n) {
+    return replacement_cumulative<VEC, INT>(rng, first, last, size, offset);
+  } else {
+    dqrng::alias_table<INT> table(first, last);
+    return replacement_alias<VEC, INT>(rng, table, size, offset);
+  }
+}
+
 template<typename VEC, typename INT>
 inline VEC no_replacement_shuffle(dqrng::random_64bit_generator &rng, INT n, INT size, int offset) {
   VEC tmp(n);
@@ -61,6 +199,81 @@ inline VEC no_replacement_set(dqrng::random_64bit_generator &rng, INT n, INT siz
   return result;
 }
 
+// Draw K uniformly distributed integers result[j] in [0, n - j) from a single
+// 64 bit random number, provided that n (n - 1) ... (n - K + 1) does not
+// exceed 2^64. Each index is taken from the high part of the product of the
+// remaining low part with the next range. As in Lemire's method for a single
+// range, the final low part is compared against a threshold, which is only
+// computed when needed (Brackett-Rozinsky and Lemire, 2024,
+// doi:10.1002/spe.3369). The recursion over K unrolls the loops at compile
+// time.
+template<int K>
+struct batched_bounded {
+  static uint64_t product(uint64_t n) {
+    return n * batched_bounded<K - 1>::product(n - 1);
+  }
+
+  static uint64_t draw(uint64_t leftover, uint64_t n, uint64_t* result) {
+    using pcg_extras::pcg128_t;
+    pcg128_t m = pcg128_t(leftover) * pcg128_t(n);
+    result[0] = uint64_t(m >> 64);
+    return batched_bounded<K - 1>::draw(uint64_t(m), n - 1, result + 1);
+  }
+
+  template<typename RandomIt>
+  static void swap(RandomIt first, uint64_t n, const uint64_t* result) {
+    std::swap(first[n - 1], first[result[0]]);
+    batched_bounded<K - 1>::swap(first, n - 1, result + 1);
+  }
+
+  static void generate(dqrng::random_64bit_generator &rng, uint64_t n, uint64_t* result) {
+    uint64_t leftover = draw(rng(), n, result);
+    uint64_t range = product(n);
+    if (leftover < range) {
+      uint64_t threshold = -range % range;
+      while (leftover < threshold)
+        leftover = draw(rng(), n, result);
+    }
+  }
+};
+
+template<>
+struct batched_bounded<0> {
+  static uint64_t product(uint64_t) {return 1;}
+  static uint64_t draw(uint64_t leftover, uint64_t, uint64_t*) {return leftover;}
+  template<typename RandomIt>
+  static void swap(RandomIt, uint64_t, const uint64_t*) {}
+};
+
+// Perform the steps of the Fisher-Yates shuffle from the back with K swaps per
+// batch while more than 'bound' elements remain. Returns the number of
+// remaining elements.
+template<int K, typename RandomIt>
+inline uint64_t shuffle_batched(dqrng::random_64bit_generator &rng, RandomIt first, uint64_t n,
+                                uint64_t bound) {
+  uint64_t result[K];
+  for (; n > bound && n > K; n -= K) {
+    batched_bounded<K>::generate(rng, n, result);
+    batched_bounded<K>::swap(first, n, result);
+  }
+  return n;
+}
+
+// Fisher-Yates shuffle of [first, first + n), where the random indices for up
+// to six consecutive swaps are drawn from one 64 bit random number. The batch
+// size grows as the number of remaining elements decreases, such that the
+// product of the ranges stays well below 2^64.
+template<typename RandomIt>
+inline void shuffle(dqrng::random_64bit_generator &rng, RandomIt first, uint64_t n) {
+  n = shuffle_batched<1>(rng, first, n, uint64_t(1) << 30);
+  n = shuffle_batched<2>(rng, first, n, uint64_t(1) << 19);
+  n = shuffle_batched<3>(rng, first, n, uint64_t(1) << 14);
+  n = shuffle_batched<4>(rng, first, n, uint64_t(1) << 11);
+  n = shuffle_batched<5>(rng, first, n, uint64_t(1) << 9);
+  n = shuffle_batched<6>(rng, first, n, 6);
+  shuffle_batched<1>(rng, first, n, 1);
+}
+
 template<typename VEC, typename INT>
 inline VEC sample(dqrng::random_64bit_generator &rng, INT n, INT size, bool replace, int offset = 0) {
   if (replace || size <= 1) {
@@ -179,6 +179,41 @@ RcppExport SEXP _dqrng_dqrunif(SEXP nSEXP, SEXP minSEXP, SEXP maxSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// dqrunif_antithetic
+Rcpp::NumericVector dqrunif_antithetic(size_t n, double min, double max);
+static SEXP _dqrng_dqrunif_antithetic_try(SEXP nSEXP, SEXP minSEXP, SEXP maxSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< double >::type min(minSEXP);
+    Rcpp::traits::input_parameter< double >::type max(maxSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrunif_antithetic(n, min, max));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrunif_antithetic(SEXP nSEXP, SEXP minSEXP, SEXP maxSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrunif_antithetic_try(nSEXP, minSEXP, maxSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // runif
 double runif(double min, double max);
 static SEXP _dqrng_runif_try(SEXP minSEXP, SEXP maxSEXP) {
@@ -248,6 +283,41 @@ RcppExport SEXP _dqrng_dqrnorm(SEXP nSEXP, SEXP meanSEXP, SEXP sdSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// dqrnorm_antithetic
+Rcpp::NumericVector dqrnorm_antithetic(size_t n, double mean, double sd);
+static SEXP _dqrng_dqrnorm_antithetic_try(SEXP nSEXP, SEXP meanSEXP, SEXP sdSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< double >::type mean(meanSEXP);
+    Rcpp::traits::input_parameter< double >::type sd(sdSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrnorm_antithetic(n, mean, sd));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrnorm_antithetic(SEXP nSEXP, SEXP meanSEXP, SEXP sdSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrnorm_antithetic_try(nSEXP, meanSEXP, sdSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // rnorm
 double rnorm(double mean, double sd);
 static SEXP _dqrng_rnorm_try(SEXP meanSEXP, SEXP sdSEXP) {
@@ -349,19 +419,20 @@ RcppExport SEXP _dqrng_rexp(SEXP rateSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// get_rng
-Rcpp::XPtr<dqrng::random_64bit_generator> get_rng();
-static SEXP _dqrng_get_rng_try() {
+// dqrunif_sorted
+Rcpp::NumericVector dqrunif_sorted(size_t n);
+static SEXP _dqrng_dqrunif_sorted_try(SEXP nSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    rcpp_result_gen = Rcpp::wrap(get_rng());
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrunif_sorted(n));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _dqrng_get_rng() {
+RcppExport SEXP _dqrng_dqrunif_sorted(SEXP nSEXP) {
     SEXP rcpp_result_gen;
     {
-        rcpp_result_gen = PROTECT(_dqrng_get_rng_try());
+        rcpp_result_gen = PROTECT(_dqrng_dqrunif_sorted_try(nSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -381,20 +452,23 @@ RcppExport SEXP _dqrng_get_rng() {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// dqrrademacher
-Rcpp::IntegerVector dqrrademacher(size_t n);
-static SEXP _dqrng_dqrrademacher_try(SEXP nSEXP) {
+// dqrsobol
+Rcpp::NumericMatrix dqrsobol(int n, int d, std::string scrambling, double skip);
+static SEXP _dqrng_dqrsobol_try(SEXP nSEXP, SEXP dSEXP, SEXP scramblingSEXP, SEXP skipSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
-    rcpp_result_gen = Rcpp::wrap(dqrrademacher(n));
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< int >::type d(dSEXP);
+    Rcpp::traits::input_parameter< std::string >::type scrambling(scramblingSEXP);
+    Rcpp::traits::input_parameter< double >::type skip(skipSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrsobol(n, d, scrambling, skip));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _dqrng_dqrrademacher(SEXP nSEXP) {
+RcppExport SEXP _dqrng_dqrsobol(SEXP nSEXP, SEXP dSEXP, SEXP scramblingSEXP, SEXP skipSEXP) {
     SEXP rcpp_result_gen;
     {
-        rcpp_result_gen = PROTECT(_dqrng_dqrrademacher_try(nSEXP));
+        rcpp_result_gen = PROTECT(_dqrng_dqrsobol_try(nSEXP, dSEXP, scramblingSEXP, skipSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -414,24 +488,23 @@ RcppExport SEXP _dqrng_dqrrademacher(SEXP nSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// dqsample_int
-Rcpp::IntegerVector dqsample_int(int n, int size, bool replace, Rcpp::Nullable<Rcpp::NumericVector> probs, int offset);
-static SEXP _dqrng_dqsample_int_try(SEXP nSEXP, SEXP sizeSEXP, SEXP replaceSEXP, SEXP probsSEXP, SEXP offsetSEXP) {
+// dqrhalton
+Rcpp::NumericMatrix dqrhalton(int n, int d, bool permute, double skip);
+static SEXP _dqrng_dqrhalton_try(SEXP nSEXP, SEXP dSEXP, SEXP permuteSEXP, SEXP skipSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< int >::type n(nSEXP);
-    Rcpp::traits::input_parameter< int >::type size(sizeSEXP);
-    Rcpp::traits::input_parameter< bool >::type replace(replaceSEXP);
-    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::NumericVector> >::type probs(probsSEXP);
-    Rcpp::traits::input_parameter< int >::type offset(offsetSEXP);
-    rcpp_result_gen = Rcpp::wrap(dqsample_int(n, size, replace, probs, offset));
+    Rcpp::traits::input_parameter< int >::type d(dSEXP);
+    Rcpp::traits::input_parameter< bool >::type permute(permuteSEXP);
+    Rcpp::traits::input_parameter< double >::type skip(skipSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrhalton(n, d, permute, skip));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _dqrng_dqsample_int(SEXP nSEXP, SEXP sizeSEXP, SEXP replaceSEXP, SEXP probsSEXP, SEXP offsetSEXP) {
+RcppExport SEXP _dqrng_dqrhalton(SEXP nSEXP, SEXP dSEXP, SEXP permuteSEXP, SEXP skipSEXP) {
     SEXP rcpp_result_gen;
     {
-        rcpp_result_gen = PROTECT(_dqrng_dqsample_int_try(nSEXP, sizeSEXP, replaceSEXP, probsSEXP, offsetSEXP));
+        rcpp_result_gen = PROTECT(_dqrng_dqrhalton_try(nSEXP, dSEXP, permuteSEXP, skipSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -451,24 +524,1495 @@ RcppExport SEXP _dqrng_dqsample_int(SEXP nSEXP, SEXP sizeSEXP, SEXP replaceSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// dqsample_num
-Rcpp::NumericVector dqsample_num(double n, double size, bool replace, Rcpp::Nullable<Rcpp::NumericVector> probs, int offset);
-static SEXP _dqrng_dqsample_num_try(SEXP nSEXP, SEXP sizeSEXP, SEXP replaceSEXP, SEXP probsSEXP, SEXP offsetSEXP) {
+// dqrlhs
+Rcpp::NumericMatrix dqrlhs(int n, int d);
+static SEXP _dqrng_dqrlhs_try(SEXP nSEXP, SEXP dSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< double >::type n(nSEXP);
-    Rcpp::traits::input_parameter< double >::type size(sizeSEXP);
-    Rcpp::traits::input_parameter< bool >::type replace(replaceSEXP);
-    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::NumericVector> >::type probs(probsSEXP);
-    Rcpp::traits::input_parameter< int >::type offset(offsetSEXP);
-    rcpp_result_gen = Rcpp::wrap(dqsample_num(n, size, replace, probs, offset));
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< int >::type d(dSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrlhs(n, d));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _dqrng_dqsample_num(SEXP nSEXP, SEXP sizeSEXP, SEXP replaceSEXP, SEXP probsSEXP, SEXP offsetSEXP) {
+RcppExport SEXP _dqrng_dqrlhs(SEXP nSEXP, SEXP dSEXP) {
     SEXP rcpp_result_gen;
     {
-        rcpp_result_gen = PROTECT(_dqrng_dqsample_num_try(nSEXP, sizeSEXP, replaceSEXP, probsSEXP, offsetSEXP));
+        rcpp_result_gen = PROTECT(_dqrng_dqrlhs_try(nSEXP, dSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrunif_stratified
+Rcpp::NumericVector dqrunif_stratified(Rcpp::IntegerVector n, Rcpp::NumericVector breaks);
+static SEXP _dqrng_dqrunif_stratified_try(SEXP nSEXP, SEXP breaksSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::IntegerVector >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type breaks(breaksSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrunif_stratified(n, breaks));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrunif_stratified(SEXP nSEXP, SEXP breaksSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrunif_stratified_try(nSEXP, breaksSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrbrownian
+Rcpp::NumericMatrix dqrbrownian(int n_paths, int n_steps, double dt, double drift, double sigma, double x0, bool bridge);
+static SEXP _dqrng_dqrbrownian_try(SEXP n_pathsSEXP, SEXP n_stepsSEXP, SEXP dtSEXP, SEXP driftSEXP, SEXP sigmaSEXP, SEXP x0SEXP, SEXP bridgeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n_paths(n_pathsSEXP);
+    Rcpp::traits::input_parameter< int >::type n_steps(n_stepsSEXP);
+    Rcpp::traits::input_parameter< double >::type dt(dtSEXP);
+    Rcpp::traits::input_parameter< double >::type drift(driftSEXP);
+    Rcpp::traits::input_parameter< double >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type x0(x0SEXP);
+    Rcpp::traits::input_parameter< bool >::type bridge(bridgeSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrbrownian(n_paths, n_steps, dt, drift, sigma, x0, bridge));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrbrownian(SEXP n_pathsSEXP, SEXP n_stepsSEXP, SEXP dtSEXP, SEXP driftSEXP, SEXP sigmaSEXP, SEXP x0SEXP, SEXP bridgeSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrbrownian_try(n_pathsSEXP, n_stepsSEXP, dtSEXP, driftSEXP, sigmaSEXP, x0SEXP, bridgeSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrgbm
+Rcpp::NumericMatrix dqrgbm(int n_paths, int n_steps, double dt, double drift, double sigma, double s0, bool bridge);
+static SEXP _dqrng_dqrgbm_try(SEXP n_pathsSEXP, SEXP n_stepsSEXP, SEXP dtSEXP, SEXP driftSEXP, SEXP sigmaSEXP, SEXP s0SEXP, SEXP bridgeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n_paths(n_pathsSEXP);
+    Rcpp::traits::input_parameter< int >::type n_steps(n_stepsSEXP);
+    Rcpp::traits::input_parameter< double >::type dt(dtSEXP);
+    Rcpp::traits::input_parameter< double >::type drift(driftSEXP);
+    Rcpp::traits::input_parameter< double >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< double >::type s0(s0SEXP);
+    Rcpp::traits::input_parameter< bool >::type bridge(bridgeSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrgbm(n_paths, n_steps, dt, drift, sigma, s0, bridge));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrgbm(SEXP n_pathsSEXP, SEXP n_stepsSEXP, SEXP dtSEXP, SEXP driftSEXP, SEXP sigmaSEXP, SEXP s0SEXP, SEXP bridgeSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrgbm_try(n_pathsSEXP, n_stepsSEXP, dtSEXP, driftSEXP, sigmaSEXP, s0SEXP, bridgeSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrbinom
+Rcpp::IntegerVector dqrbinom(size_t n, Rcpp::NumericVector size, Rcpp::NumericVector prob);
+static SEXP _dqrng_dqrbinom_try(SEXP nSEXP, SEXP sizeSEXP, SEXP probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type prob(probSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrbinom(n, size, prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrbinom(SEXP nSEXP, SEXP sizeSEXP, SEXP probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrbinom_try(nSEXP, sizeSEXP, probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrgeom
+Rcpp::NumericVector dqrgeom(size_t n, Rcpp::NumericVector prob);
+static SEXP _dqrng_dqrgeom_try(SEXP nSEXP, SEXP probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type prob(probSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrgeom(n, prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrgeom(SEXP nSEXP, SEXP probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrgeom_try(nSEXP, probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrnbinom
+Rcpp::NumericVector dqrnbinom(size_t n, Rcpp::NumericVector size, Rcpp::Nullable<Rcpp::NumericVector> prob, Rcpp::Nullable<Rcpp::NumericVector> mu);
+static SEXP _dqrng_dqrnbinom_try(SEXP nSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP muSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::NumericVector> >::type prob(probSEXP);
+    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::NumericVector> >::type mu(muSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrnbinom(n, size, prob, mu));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrnbinom(SEXP nSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP muSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrnbinom_try(nSEXP, sizeSEXP, probSEXP, muSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrzipf
+Rcpp::NumericVector dqrzipf(size_t n, Rcpp::NumericVector N, Rcpp::NumericVector s);
+static SEXP _dqrng_dqrzipf_try(SEXP nSEXP, SEXP NSEXP, SEXP sSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type N(NSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type s(sSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrzipf(n, N, s));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrzipf(SEXP nSEXP, SEXP NSEXP, SEXP sSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrzipf_try(nSEXP, NSEXP, sSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrmixture_family
+Rcpp::NumericVector dqrmixture_family(size_t n, Rcpp::NumericVector weights, std::string family, Rcpp::NumericVector param1, Rcpp::NumericVector param2);
+static SEXP _dqrng_dqrmixture_family_try(SEXP nSEXP, SEXP weightsSEXP, SEXP familySEXP, SEXP param1SEXP, SEXP param2SEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type weights(weightsSEXP);
+    Rcpp::traits::input_parameter< std::string >::type family(familySEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type param1(param1SEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type param2(param2SEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrmixture_family(n, weights, family, param1, param2));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrmixture_family(SEXP nSEXP, SEXP weightsSEXP, SEXP familySEXP, SEXP param1SEXP, SEXP param2SEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrmixture_family_try(nSEXP, weightsSEXP, familySEXP, param1SEXP, param2SEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrsparse_pattern
+Rcpp::List dqrsparse_pattern(int nrow, int ncol, double density);
+static SEXP _dqrng_dqrsparse_pattern_try(SEXP nrowSEXP, SEXP ncolSEXP, SEXP densitySEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type nrow(nrowSEXP);
+    Rcpp::traits::input_parameter< int >::type ncol(ncolSEXP);
+    Rcpp::traits::input_parameter< double >::type density(densitySEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrsparse_pattern(nrow, ncol, density));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrsparse_pattern(SEXP nrowSEXP, SEXP ncolSEXP, SEXP densitySEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrsparse_pattern_try(nrowSEXP, ncolSEXP, densitySEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrgraph_gnp
+Rcpp::IntegerMatrix dqrgraph_gnp(int n, double p);
+static SEXP _dqrng_dqrgraph_gnp_try(SEXP nSEXP, SEXP pSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< double >::type p(pSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrgraph_gnp(n, p));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrgraph_gnp(SEXP nSEXP, SEXP pSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrgraph_gnp_try(nSEXP, pSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrgraph_gnm
+Rcpp::IntegerMatrix dqrgraph_gnm(int n, double m);
+static SEXP _dqrng_dqrgraph_gnm_try(SEXP nSEXP, SEXP mSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< double >::type m(mSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrgraph_gnm(n, m));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrgraph_gnm(SEXP nSEXP, SEXP mSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrgraph_gnm_try(nSEXP, mSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrgraph_sbm
+Rcpp::IntegerMatrix dqrgraph_sbm(Rcpp::IntegerVector block_sizes, Rcpp::NumericMatrix prob);
+static SEXP _dqrng_dqrgraph_sbm_try(SEXP block_sizesSEXP, SEXP probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::IntegerVector >::type block_sizes(block_sizesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericMatrix >::type prob(probSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrgraph_sbm(block_sizes, prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrgraph_sbm(SEXP block_sizesSEXP, SEXP probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrgraph_sbm_try(block_sizesSEXP, probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrmultinom
+Rcpp::IntegerMatrix dqrmultinom(int n, int size, Rcpp::NumericVector prob);
+static SEXP _dqrng_dqrmultinom_try(SEXP nSEXP, SEXP sizeSEXP, SEXP probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< int >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type prob(probSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrmultinom(n, size, prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrmultinom(SEXP nSEXP, SEXP sizeSEXP, SEXP probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrmultinom_try(nSEXP, sizeSEXP, probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrtnorm
+Rcpp::NumericVector dqrtnorm(size_t n, Rcpp::NumericVector mean, Rcpp::NumericVector sd, Rcpp::NumericVector lower, Rcpp::NumericVector upper);
+static SEXP _dqrng_dqrtnorm_try(SEXP nSEXP, SEXP meanSEXP, SEXP sdSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type mean(meanSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type sd(sdSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type upper(upperSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrtnorm(n, mean, sd, lower, upper));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrtnorm(SEXP nSEXP, SEXP meanSEXP, SEXP sdSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrtnorm_try(nSEXP, meanSEXP, sdSEXP, lowerSEXP, upperSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrlnorm
+Rcpp::NumericVector dqrlnorm(size_t n, Rcpp::NumericVector meanlog, Rcpp::NumericVector sdlog);
+static SEXP _dqrng_dqrlnorm_try(SEXP nSEXP, SEXP meanlogSEXP, SEXP sdlogSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type meanlog(meanlogSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type sdlog(sdlogSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrlnorm(n, meanlog, sdlog));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrlnorm(SEXP nSEXP, SEXP meanlogSEXP, SEXP sdlogSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrlnorm_try(nSEXP, meanlogSEXP, sdlogSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrweibull
+Rcpp::NumericVector dqrweibull(size_t n, Rcpp::NumericVector shape, Rcpp::NumericVector scale);
+static SEXP _dqrng_dqrweibull_try(SEXP nSEXP, SEXP shapeSEXP, SEXP scaleSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type shape(shapeSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type scale(scaleSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrweibull(n, shape, scale));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrweibull(SEXP nSEXP, SEXP shapeSEXP, SEXP scaleSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrweibull_try(nSEXP, shapeSEXP, scaleSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrcauchy
+Rcpp::NumericVector dqrcauchy(size_t n, Rcpp::NumericVector location, Rcpp::NumericVector scale);
+static SEXP _dqrng_dqrcauchy_try(SEXP nSEXP, SEXP locationSEXP, SEXP scaleSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type location(locationSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type scale(scaleSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrcauchy(n, location, scale));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrcauchy(SEXP nSEXP, SEXP locationSEXP, SEXP scaleSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrcauchy_try(nSEXP, locationSEXP, scaleSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrlogis
+Rcpp::NumericVector dqrlogis(size_t n, Rcpp::NumericVector location, Rcpp::NumericVector scale);
+static SEXP _dqrng_dqrlogis_try(SEXP nSEXP, SEXP locationSEXP, SEXP scaleSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type location(locationSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type scale(scaleSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrlogis(n, location, scale));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrlogis(SEXP nSEXP, SEXP locationSEXP, SEXP scaleSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrlogis_try(nSEXP, locationSEXP, scaleSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrgumbel
+Rcpp::NumericVector dqrgumbel(size_t n, Rcpp::NumericVector location, Rcpp::NumericVector scale);
+static SEXP _dqrng_dqrgumbel_try(SEXP nSEXP, SEXP locationSEXP, SEXP scaleSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type location(locationSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type scale(scaleSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrgumbel(n, location, scale));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrgumbel(SEXP nSEXP, SEXP locationSEXP, SEXP scaleSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrgumbel_try(nSEXP, locationSEXP, scaleSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrlaplace
+Rcpp::NumericVector dqrlaplace(size_t n, Rcpp::NumericVector location, Rcpp::NumericVector scale);
+static SEXP _dqrng_dqrlaplace_try(SEXP nSEXP, SEXP locationSEXP, SEXP scaleSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type location(locationSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type scale(scaleSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrlaplace(n, location, scale));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrlaplace(SEXP nSEXP, SEXP locationSEXP, SEXP scaleSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrlaplace_try(nSEXP, locationSEXP, scaleSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrvonmises
+Rcpp::NumericVector dqrvonmises(size_t n, Rcpp::NumericVector mu, Rcpp::NumericVector kappa);
+static SEXP _dqrng_dqrvonmises_try(SEXP nSEXP, SEXP muSEXP, SEXP kappaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type kappa(kappaSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrvonmises(n, mu, kappa));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrvonmises(SEXP nSEXP, SEXP muSEXP, SEXP kappaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrvonmises_try(nSEXP, muSEXP, kappaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrwrappednorm
+Rcpp::NumericVector dqrwrappednorm(size_t n, Rcpp::NumericVector mu, Rcpp::NumericVector sd);
+static SEXP _dqrng_dqrwrappednorm_try(SEXP nSEXP, SEXP muSEXP, SEXP sdSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type sd(sdSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrwrappednorm(n, mu, sd));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrwrappednorm(SEXP nSEXP, SEXP muSEXP, SEXP sdSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrwrappednorm_try(nSEXP, muSEXP, sdSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrwrappedcauchy
+Rcpp::NumericVector dqrwrappedcauchy(size_t n, Rcpp::NumericVector mu, Rcpp::NumericVector rho);
+static SEXP _dqrng_dqrwrappedcauchy_try(SEXP nSEXP, SEXP muSEXP, SEXP rhoSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type rho(rhoSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrwrappedcauchy(n, mu, rho));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrwrappedcauchy(SEXP nSEXP, SEXP muSEXP, SEXP rhoSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrwrappedcauchy_try(nSEXP, muSEXP, rhoSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrhyper
+Rcpp::IntegerVector dqrhyper(size_t nn, Rcpp::NumericVector m, Rcpp::NumericVector n, Rcpp::NumericVector k);
+static SEXP _dqrng_dqrhyper_try(SEXP nnSEXP, SEXP mSEXP, SEXP nSEXP, SEXP kSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type nn(nnSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type m(mSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type k(kSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrhyper(nn, m, n, k));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrhyper(SEXP nnSEXP, SEXP mSEXP, SEXP nSEXP, SEXP kSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrhyper_try(nnSEXP, mSEXP, nSEXP, kSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrmvhyper
+Rcpp::IntegerMatrix dqrmvhyper(int n, Rcpp::NumericVector m, int k);
+static SEXP _dqrng_dqrmvhyper_try(SEXP nSEXP, SEXP mSEXP, SEXP kSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type m(mSEXP);
+    Rcpp::traits::input_parameter< int >::type k(kSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrmvhyper(n, m, k));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrmvhyper(SEXP nSEXP, SEXP mSEXP, SEXP kSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrmvhyper_try(nSEXP, mSEXP, kSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrdirichlet
+Rcpp::NumericMatrix dqrdirichlet(int n, Rcpp::NumericVector alpha);
+static SEXP _dqrng_dqrdirichlet_try(SEXP nSEXP, SEXP alphaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type alpha(alphaSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrdirichlet(n, alpha));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrdirichlet(SEXP nSEXP, SEXP alphaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrdirichlet_try(nSEXP, alphaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrwishart
+Rcpp::NumericVector dqrwishart(int n, double df, Rcpp::NumericMatrix Sigma);
+static SEXP _dqrng_dqrwishart_try(SEXP nSEXP, SEXP dfSEXP, SEXP SigmaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< double >::type df(dfSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericMatrix >::type Sigma(SigmaSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrwishart(n, df, Sigma));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrwishart(SEXP nSEXP, SEXP dfSEXP, SEXP SigmaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrwishart_try(nSEXP, dfSEXP, SigmaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrinvwishart
+Rcpp::NumericVector dqrinvwishart(int n, double df, Rcpp::NumericMatrix Sigma);
+static SEXP _dqrng_dqrinvwishart_try(SEXP nSEXP, SEXP dfSEXP, SEXP SigmaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< double >::type df(dfSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericMatrix >::type Sigma(SigmaSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrinvwishart(n, df, Sigma));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrinvwishart(SEXP nSEXP, SEXP dfSEXP, SEXP SigmaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrinvwishart_try(nSEXP, dfSEXP, SigmaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrsphere
+Rcpp::NumericMatrix dqrsphere(int n, int d);
+static SEXP _dqrng_dqrsphere_try(SEXP nSEXP, SEXP dSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< int >::type d(dSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrsphere(n, d));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrsphere(SEXP nSEXP, SEXP dSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrsphere_try(nSEXP, dSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrball
+Rcpp::NumericMatrix dqrball(int n, int d);
+static SEXP _dqrng_dqrball_try(SEXP nSEXP, SEXP dSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< int >::type d(dSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrball(n, d));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrball(SEXP nSEXP, SEXP dSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrball_try(nSEXP, dSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrsimplex
+Rcpp::NumericMatrix dqrsimplex(int n, int d);
+static SEXP _dqrng_dqrsimplex_try(SEXP nSEXP, SEXP dSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< int >::type d(dSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrsimplex(n, d));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrsimplex(SEXP nSEXP, SEXP dSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrsimplex_try(nSEXP, dSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrorthogonal
+Rcpp::NumericVector dqrorthogonal(int n, int d);
+static SEXP _dqrng_dqrorthogonal_try(SEXP nSEXP, SEXP dSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< int >::type d(dSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrorthogonal(n, d));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrorthogonal(SEXP nSEXP, SEXP dSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrorthogonal_try(nSEXP, dSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrrotation
+Rcpp::NumericVector dqrrotation(int n, int d);
+static SEXP _dqrng_dqrrotation_try(SEXP nSEXP, SEXP dSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< int >::type d(dSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrrotation(n, d));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrrotation(SEXP nSEXP, SEXP dSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrrotation_try(nSEXP, dSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrmvnorm_chol
+Rcpp::NumericMatrix dqrmvnorm_chol(int n, Rcpp::NumericVector mean, Rcpp::NumericMatrix root, Rcpp::IntegerVector pivot, int threads);
+static SEXP _dqrng_dqrmvnorm_chol_try(SEXP nSEXP, SEXP meanSEXP, SEXP rootSEXP, SEXP pivotSEXP, SEXP threadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type mean(meanSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericMatrix >::type root(rootSEXP);
+    Rcpp::traits::input_parameter< Rcpp::IntegerVector >::type pivot(pivotSEXP);
+    Rcpp::traits::input_parameter< int >::type threads(threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrmvnorm_chol(n, mean, root, pivot, threads));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrmvnorm_chol(SEXP nSEXP, SEXP meanSEXP, SEXP rootSEXP, SEXP pivotSEXP, SEXP threadsSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrmvnorm_chol_try(nSEXP, meanSEXP, rootSEXP, pivotSEXP, threadsSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// get_rng
+Rcpp::XPtr<dqrng::random_64bit_generator> get_rng();
+static SEXP _dqrng_get_rng_try() {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    rcpp_result_gen = Rcpp::wrap(get_rng());
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_get_rng() {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_get_rng_try());
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrrademacher
+Rcpp::IntegerVector dqrrademacher(size_t n);
+static SEXP _dqrng_dqrrademacher_try(SEXP nSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< size_t >::type n(nSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrrademacher(n));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrrademacher(SEXP nSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrrademacher_try(nSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqsample_int
+Rcpp::IntegerVector dqsample_int(int n, int size, bool replace, Rcpp::Nullable<Rcpp::NumericVector> probs, int offset);
+static SEXP _dqrng_dqsample_int_try(SEXP nSEXP, SEXP sizeSEXP, SEXP replaceSEXP, SEXP probsSEXP, SEXP offsetSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< int >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< bool >::type replace(replaceSEXP);
+    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::NumericVector> >::type probs(probsSEXP);
+    Rcpp::traits::input_parameter< int >::type offset(offsetSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqsample_int(n, size, replace, probs, offset));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqsample_int(SEXP nSEXP, SEXP sizeSEXP, SEXP replaceSEXP, SEXP probsSEXP, SEXP offsetSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqsample_int_try(nSEXP, sizeSEXP, replaceSEXP, probsSEXP, offsetSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqsample_num
+Rcpp::NumericVector dqsample_num(double n, double size, bool replace, Rcpp::Nullable<Rcpp::NumericVector> probs, int offset);
+static SEXP _dqrng_dqsample_num_try(SEXP nSEXP, SEXP sizeSEXP, SEXP replaceSEXP, SEXP probsSEXP, SEXP offsetSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< double >::type n(nSEXP);
+    Rcpp::traits::input_parameter< double >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< bool >::type replace(replaceSEXP);
+    Rcpp::traits::input_parameter< Rcpp::Nullable<Rcpp::NumericVector> >::type probs(probsSEXP);
+    Rcpp::traits::input_parameter< int >::type offset(offsetSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqsample_num(n, size, replace, probs, offset));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqsample_num(SEXP nSEXP, SEXP sizeSEXP, SEXP replaceSEXP, SEXP probsSEXP, SEXP offsetSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqsample_num_try(nSEXP, sizeSEXP, replaceSEXP, probsSEXP, offsetSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqrperm_matrix
+Rcpp::IntegerMatrix dqrperm_matrix(int n, int B, int threads);
+static SEXP _dqrng_dqrperm_matrix_try(SEXP nSEXP, SEXP BSEXP, SEXP threadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< int >::type B(BSEXP);
+    Rcpp::traits::input_parameter< int >::type threads(threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqrperm_matrix(n, B, threads));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqrperm_matrix(SEXP nSEXP, SEXP BSEXP, SEXP threadsSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqrperm_matrix_try(nSEXP, BSEXP, threadsSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqalias_table
+SEXP dqalias_table(Rcpp::NumericVector prob);
+static SEXP _dqrng_dqalias_table_try(SEXP probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector >::type prob(probSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqalias_table(prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqalias_table(SEXP probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqalias_table_try(probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqsample_alias_int
+Rcpp::IntegerVector dqsample_alias_int(SEXP table, int n, int size, int offset);
+static SEXP _dqrng_dqsample_alias_int_try(SEXP tableSEXP, SEXP nSEXP, SEXP sizeSEXP, SEXP offsetSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type table(tableSEXP);
+    Rcpp::traits::input_parameter< int >::type n(nSEXP);
+    Rcpp::traits::input_parameter< int >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< int >::type offset(offsetSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqsample_alias_int(table, n, size, offset));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqsample_alias_int(SEXP tableSEXP, SEXP nSEXP, SEXP sizeSEXP, SEXP offsetSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqsample_alias_int_try(tableSEXP, nSEXP, sizeSEXP, offsetSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// dqsample_alias_num
+Rcpp::NumericVector dqsample_alias_num(SEXP table, double n, double size, int offset);
+static SEXP _dqrng_dqsample_alias_num_try(SEXP tableSEXP, SEXP nSEXP, SEXP sizeSEXP, SEXP offsetSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< SEXP >::type table(tableSEXP);
+    Rcpp::traits::input_parameter< double >::type n(nSEXP);
+    Rcpp::traits::input_parameter< double >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< int >::type offset(offsetSEXP);
+    rcpp_result_gen = Rcpp::wrap(dqsample_alias_num(table, n, size, offset));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _dqrng_dqsample_alias_num(SEXP tableSEXP, SEXP nSEXP, SEXP sizeSEXP, SEXP offsetSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        rcpp_result_gen = PROTECT(_dqrng_dqsample_alias_num_try(tableSEXP, nSEXP, sizeSEXP, offsetSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -510,15 +2054,59 @@ static int _dqrng_RcppExport_validate(const char* sig) {
         signatures.insert("std::vector<std::string>(*dqrng_get_state)()");
         signatures.insert("void(*dqrng_set_state)(std::vector<std::string>)");
         signatures.insert("Rcpp::NumericVector(*dqrunif)(size_t,double,double)");
+        signatures.insert("Rcpp::NumericVector(*dqrunif_antithetic)(size_t,double,double)");
         signatures.insert("double(*runif)(double,double)");
         signatures.insert("Rcpp::NumericVector(*dqrnorm)(size_t,double,double)");
+        signatures.insert("Rcpp::NumericVector(*dqrnorm_antithetic)(size_t,double,double)");
         signatures.insert("double(*rnorm)(double,double)");
         signatures.insert("Rcpp::NumericVector(*dqrexp)(size_t,double)");
         signatures.insert("double(*rexp)(double)");
+        signatures.insert("Rcpp::NumericVector(*dqrunif_sorted)(size_t)");
+        signatures.insert("Rcpp::NumericMatrix(*dqrsobol)(int,int,std::string,double)");
+        signatures.insert("Rcpp::NumericMatrix(*dqrhalton)(int,int,bool,double)");
+        signatures.insert("Rcpp::NumericMatrix(*dqrlhs)(int,int)");
+        signatures.insert("Rcpp::NumericVector(*dqrunif_stratified)(Rcpp::IntegerVector,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::NumericMatrix(*dqrbrownian)(int,int,double,double,double,double,bool)");
+        signatures.insert("Rcpp::NumericMatrix(*dqrgbm)(int,int,double,double,double,double,bool)");
+        signatures.insert("Rcpp::IntegerVector(*dqrbinom)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::NumericVector(*dqrgeom)(size_t,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::NumericVector(*dqrnbinom)(size_t,Rcpp::NumericVector,Rcpp::Nullable<Rcpp::NumericVector>,Rcpp::Nullable<Rcpp::NumericVector>)");
+        signatures.insert("Rcpp::NumericVector(*dqrzipf)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::NumericVector(*dqrmixture_family)(size_t,Rcpp::NumericVector,std::string,Rcpp::NumericVector,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::List(*dqrsparse_pattern)(int,int,double)");
+        signatures.insert("Rcpp::IntegerMatrix(*dqrgraph_gnp)(int,double)");
+        signatures.insert("Rcpp::IntegerMatrix(*dqrgraph_gnm)(int,double)");
+        signatures.insert("Rcpp::IntegerMatrix(*dqrgraph_sbm)(Rcpp::IntegerVector,Rcpp::NumericMatrix)");
+        signatures.insert("Rcpp::IntegerMatrix(*dqrmultinom)(int,int,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::NumericVector(*dqrtnorm)(size_t,Rcpp::NumericVector,Rcpp::NumericVector,Rcpp::NumericVector,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::NumericVector(*dqrlnorm)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::NumericVector(*dqrweibull)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::NumericVector(*dqrcauchy)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::NumericVector(*dqrlogis)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::NumericVector(*dqrgumbel)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::NumericVector(*dqrlaplace)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::NumericVector(*dqrvonmises)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::NumericVector(*dqrwrappednorm)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::NumericVector(*dqrwrappedcauchy)(size_t,Rcpp::NumericVector,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::IntegerVector(*dqrhyper)(size_t,Rcpp::NumericVector,Rcpp::NumericVector,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::IntegerMatrix(*dqrmvhyper)(int,Rcpp::NumericVector,int)");
+        signatures.insert("Rcpp::NumericMatrix(*dqrdirichlet)(int,Rcpp::NumericVector)");
+        signatures.insert("Rcpp::NumericVector(*dqrwishart)(int,double,Rcpp::NumericMatrix)");
+        signatures.insert("Rcpp::NumericVector(*dqrinvwishart)(int,double,Rcpp::NumericMatrix)");
+        signatures.insert("Rcpp::NumericMatrix(*dqrsphere)(int,int)");
+        signatures.insert("Rcpp::NumericMatrix(*dqrball)(int,int)");
+        signatures.insert("Rcpp::NumericMatrix(*dqrsimplex)(int,int)");
+        signatures.insert("Rcpp::NumericVector(*dqrorthogonal)(int,int)");
+        signatures.insert("Rcpp::NumericVector(*dqrrotation)(int,int)");
+        signatures.insert("Rcpp::NumericMatrix(*dqrmvnorm_chol)(int,Rcpp::NumericVector,Rcpp::NumericMatrix,Rcpp::IntegerVector,int)");
         signatures.insert("Rcpp::XPtr<dqrng::random_64bit_generator>(*get_rng)()");
         signatures.insert("Rcpp::IntegerVector(*dqrrademacher)(size_t)");
         signatures.insert("Rcpp::IntegerVector(*dqsample_int)(int,int,bool,Rcpp::Nullable<Rcpp::NumericVector>,int)");
         signatures.insert("Rcpp::NumericVector(*dqsample_num)(double,double,bool,Rcpp::Nullable<Rcpp::NumericVector>,int)");
+        signatures.insert("Rcpp::IntegerMatrix(*dqrperm_matrix)(int,int,int)");
+        signatures.insert("SEXP(*dqalias_table)(Rcpp::NumericVector)");
+        signatures.insert("Rcpp::IntegerVector(*dqsample_alias_int)(SEXP,int,int,int)");
+        signatures.insert("Rcpp::NumericVector(*dqsample_alias_num)(SEXP,double,double,int)");
     }
     return signatures.find(sig) != signatures.end();
 }
@@ -530,15 +2118,59 @@ RcppExport SEXP _dqrng_RcppExport_registerCCallable() {
     R_RegisterCCallable("dqrng", "_dqrng_dqrng_get_state", (DL_FUNC)_dqrng_dqrng_get_state_try);
     R_RegisterCCallable("dqrng", "_dqrng_dqrng_set_state", (DL_FUNC)_dqrng_dqrng_set_state_try);
     R_RegisterCCallable("dqrng", "_dqrng_dqrunif", (DL_FUNC)_dqrng_dqrunif_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrunif_antithetic", (DL_FUNC)_dqrng_dqrunif_antithetic_try);
     R_RegisterCCallable("dqrng", "_dqrng_runif", (DL_FUNC)_dqrng_runif_try);
     R_RegisterCCallable("dqrng", "_dqrng_dqrnorm", (DL_FUNC)_dqrng_dqrnorm_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrnorm_antithetic", (DL_FUNC)_dqrng_dqrnorm_antithetic_try);
     R_RegisterCCallable("dqrng", "_dqrng_rnorm", (DL_FUNC)_dqrng_rnorm_try);
     R_RegisterCCallable("dqrng", "_dqrng_dqrexp", (DL_FUNC)_dqrng_dqrexp_try);
     R_RegisterCCallable("dqrng", "_dqrng_rexp", (DL_FUNC)_dqrng_rexp_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrunif_sorted", (DL_FUNC)_dqrng_dqrunif_sorted_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrsobol", (DL_FUNC)_dqrng_dqrsobol_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrhalton", (DL_FUNC)_dqrng_dqrhalton_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrlhs", (DL_FUNC)_dqrng_dqrlhs_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrunif_stratified", (DL_FUNC)_dqrng_dqrunif_stratified_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrbrownian", (DL_FUNC)_dqrng_dqrbrownian_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrgbm", (DL_FUNC)_dqrng_dqrgbm_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrbinom", (DL_FUNC)_dqrng_dqrbinom_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrgeom", (DL_FUNC)_dqrng_dqrgeom_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrnbinom", (DL_FUNC)_dqrng_dqrnbinom_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrzipf", (DL_FUNC)_dqrng_dqrzipf_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrmixture_family", (DL_FUNC)_dqrng_dqrmixture_family_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrsparse_pattern", (DL_FUNC)_dqrng_dqrsparse_pattern_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrgraph_gnp", (DL_FUNC)_dqrng_dqrgraph_gnp_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrgraph_gnm", (DL_FUNC)_dqrng_dqrgraph_gnm_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrgraph_sbm", (DL_FUNC)_dqrng_dqrgraph_sbm_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrmultinom", (DL_FUNC)_dqrng_dqrmultinom_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrtnorm", (DL_FUNC)_dqrng_dqrtnorm_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrlnorm", (DL_FUNC)_dqrng_dqrlnorm_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrweibull", (DL_FUNC)_dqrng_dqrweibull_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrcauchy", (DL_FUNC)_dqrng_dqrcauchy_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrlogis", (DL_FUNC)_dqrng_dqrlogis_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrgumbel", (DL_FUNC)_dqrng_dqrgumbel_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrlaplace", (DL_FUNC)_dqrng_dqrlaplace_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrvonmises", (DL_FUNC)_dqrng_dqrvonmises_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrwrappednorm", (DL_FUNC)_dqrng_dqrwrappednorm_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrwrappedcauchy", (DL_FUNC)_dqrng_dqrwrappedcauchy_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrhyper", (DL_FUNC)_dqrng_dqrhyper_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrmvhyper", (DL_FUNC)_dqrng_dqrmvhyper_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrdirichlet", (DL_FUNC)_dqrng_dqrdirichlet_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrwishart", (DL_FUNC)_dqrng_dqrwishart_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrinvwishart", (DL_FUNC)_dqrng_dqrinvwishart_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrsphere", (DL_FUNC)_dqrng_dqrsphere_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrball", (DL_FUNC)_dqrng_dqrball_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrsimplex", (DL_FUNC)_dqrng_dqrsimplex_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrorthogonal", (DL_FUNC)_dqrng_dqrorthogonal_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrrotation", (DL_FUNC)_dqrng_dqrrotation_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrmvnorm_chol", (DL_FUNC)_dqrng_dqrmvnorm_chol_try);
     R_RegisterCCallable("dqrng", "_dqrng_get_rng", (DL_FUNC)_dqrng_get_rng_try);
     R_RegisterCCallable("dqrng", "_dqrng_dqrrademacher", (DL_FUNC)_dqrng_dqrrademacher_try);
     R_RegisterCCallable("dqrng", "_dqrng_dqsample_int", (DL_FUNC)_dqrng_dqsample_int_try);
     R_RegisterCCallable("dqrng", "_dqrng_dqsample_num", (DL_FUNC)_dqrng_dqsample_num_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqrperm_matrix", (DL_FUNC)_dqrng_dqrperm_matrix_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqalias_table", (DL_FUNC)_dqrng_dqalias_table_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqsample_alias_int", (DL_FUNC)_dqrng_dqsample_alias_int_try);
+    R_RegisterCCallable("dqrng", "_dqrng_dqsample_alias_num", (DL_FUNC)_dqrng_dqsample_alias_num_try);
     R_RegisterCCallable("dqrng", "_dqrng_RcppExport_validate", (DL_FUNC)_dqrng_RcppExport_validate);
     return R_NilValue;
 }
@@ -549,15 +2181,59 @@ static const R_CallMethodDef CallEntries[] = {
     {"_dqrng_dqrng_get_state", (DL_FUNC) &_dqrng_dqrng_get_state, 0},
     {"_dqrng_dqrng_set_state", (DL_FUNC) &_dqrng_dqrng_set_state, 1},
     {"_dqrng_dqrunif", (DL_FUNC) &_dqrng_dqrunif, 3},
+    {"_dqrng_dqrunif_antithetic", (DL_FUNC) &_dqrng_dqrunif_antithetic, 3},
     {"_dqrng_runif", (DL_FUNC) &_dqrng_runif, 2},
     {"_dqrng_dqrnorm", (DL_FUNC) &_dqrng_dqrnorm, 3},
+    {"_dqrng_dqrnorm_antithetic", (DL_FUNC) &_dqrng_dqrnorm_antithetic, 3},
     {"_dqrng_rnorm", (DL_FUNC) &_dqrng_rnorm, 2},
     {"_dqrng_dqrexp", (DL_FUNC) &_dqrng_dqrexp, 2},
     {"_dqrng_rexp", (DL_FUNC) &_dqrng_rexp, 1},
+    {"_dqrng_dqrunif_sorted", (DL_FUNC) &_dqrng_dqrunif_sorted, 1},
+    {"_dqrng_dqrsobol", (DL_FUNC) &_dqrng_dqrsobol, 4},
+    {"_dqrng_dqrhalton", (DL_FUNC) &_dqrng_dqrhalton, 4},
+    {"_dqrng_dqrlhs", (DL_FUNC) &_dqrng_dqrlhs, 2},
+    {"_dqrng_dqrunif_stratified", (DL_FUNC) &_dqrng_dqrunif_stratified, 2},
+    {"_dqrng_dqrbrownian", (DL_FUNC) &_dqrng_dqrbrownian, 7},
+    {"_dqrng_dqrgbm", (DL_FUNC) &_dqrng_dqrgbm, 7},
+    {"_dqrng_dqrbinom", (DL_FUNC) &_dqrng_dqrbinom, 3},
+    {"_dqrng_dqrgeom", (DL_FUNC) &_dqrng_dqrgeom, 2},
+    {"_dqrng_dqrnbinom", (DL_FUNC) &_dqrng_dqrnbinom, 4},
+    {"_dqrng_dqrzipf", (DL_FUNC) &_dqrng_dqrzipf, 3},
+    {"_dqrng_dqrmixture_family", (DL_FUNC) &_dqrng_dqrmixture_family, 5},
+    {"_dqrng_dqrsparse_pattern", (DL_FUNC) &_dqrng_dqrsparse_pattern, 3},
+    {"_dqrng_dqrgraph_gnp", (DL_FUNC) &_dqrng_dqrgraph_gnp, 2},
+    {"_dqrng_dqrgraph_gnm", (DL_FUNC) &_dqrng_dqrgraph_gnm, 2},
+    {"_dqrng_dqrgraph_sbm", (DL_FUNC) &_dqrng_dqrgraph_sbm, 2},
+    {"_dqrng_dqrmultinom", (DL_FUNC) &_dqrng_dqrmultinom, 3},
+    {"_dqrng_dqrtnorm", (DL_FUNC) &_dqrng_dqrtnorm, 5},
+    {"_dqrng_dqrlnorm", (DL_FUNC) &_dqrng_dqrlnorm, 3},
+    {"_dqrng_dqrweibull", (DL_FUNC) &_dqrng_dqrweibull, 3},
+    {"_dqrng_dqrcauchy", (DL_FUNC) &_dqrng_dqrcauchy, 3},
+    {"_dqrng_dqrlogis", (DL_FUNC) &_dqrng_dqrlogis, 3},
+    {"_dqrng_dqrgumbel", (DL_FUNC) &_dqrng_dqrgumbel, 3},
+    {"_dqrng_dqrlaplace", (DL_FUNC) &_dqrng_dqrlaplace, 3},
+    {"_dqrng_dqrvonmises", (DL_FUNC) &_dqrng_dqrvonmises, 3},
+    {"_dqrng_dqrwrappednorm", (DL_FUNC) &_dqrng_dqrwrappednorm, 3},
+    {"_dqrng_dqrwrappedcauchy", (DL_FUNC) &_dqrng_dqrwrappedcauchy, 3},
+    {"_dqrng_dqrhyper", (DL_FUNC) &_dqrng_dqrhyper, 4},
+    {"_dqrng_dqrmvhyper", (DL_FUNC) &_dqrng_dqrmvhyper, 3},
+    {"_dqrng_dqrdirichlet", (DL_FUNC) &_dqrng_dqrdirichlet, 2},
+    {"_dqrng_dqrwishart", (DL_FUNC) &_dqrng_dqrwishart, 3},
+    {"_dqrng_dqrinvwishart", (DL_FUNC) &_dqrng_dqrinvwishart, 3},
+    {"_dqrng_dqrsphere", (DL_FUNC) &_dqrng_dqrsphere, 2},
+    {"_dqrng_dqrball", (DL_FUNC) &_dqrng_dqrball, 2},
+    {"_dqrng_dqrsimplex", (DL_FUNC) &_dqrng_dqrsimplex, 2},
+    {"_dqrng_dqrorthogonal", (DL_FUNC) &_dqrng_dqrorthogonal, 2},
+    {"_dqrng_dqrrotation", (DL_FUNC) &_dqrng_dqrrotation, 2},
+    {"_dqrng_dqrmvnorm_chol", (DL_FUNC) &_dqrng_dqrmvnorm_chol, 5},
     {"_dqrng_get_rng", (DL_FUNC) &_dqrng_get_rng, 0},
     {"_dqrng_dqrrademacher", (DL_FUNC) &_dqrng_dqrrademacher, 1},
     {"_dqrng_dqsample_int", (DL_FUNC) &_dqrng_dqsample_int, 5},
     {"_dqrng_dqsample_num", (DL_FUNC) &_dqrng_dqsample_num, 5},
+    {"_dqrng_dqrperm_matrix", (DL_FUNC) &_dqrng_dqrperm_matrix, 3},
+    {"_dqrng_dqalias_table", (DL_FUNC) &_dqrng_dqalias_table, 1},
+    {"_dqrng_dqsample_alias_int", (DL_FUNC) &_dqrng_dqsample_alias_int, 4},
+    {"_dqrng_dqsample_alias_num", (DL_FUNC) &_dqrng_dqsample_alias_num, 4},
     {"_dqrng_generateSeedVectors", (DL_FUNC) &_dqrng_generateSeedVectors, 2},
     {"_dqrng_RcppExport_registerCCallable", (DL_FUNC) &_dqrng_RcppExport_registerCCallable, 0},
     {NULL, NULL, 0}
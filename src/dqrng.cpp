@@ -16,11 +16,24 @@
 // You should have received a copy of the GNU Affero General Public License
 // along with dqrng.  If not, see <http://www.gnu.org/licenses/>.
 
+#define USE_FC_LEN_T
 #include <mystdint.h>
+#include <limits>
+#include <numeric>
+#include <sstream>
 #include <Rcpp.h>
+#include <R_ext/BLAS.h>
+#ifndef FCONE
+# define FCONE
+#endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include <dqrng_generator.h>
 #include <dqrng_distribution.h>
 #include <dqrng_sample.h>
+#include <dqrng_qmc.h>
+#include <dqrng_graph.h>
 #include <xoshiro.h>
 #include <pcg_random.hpp>
 #include <dqrng_threefry.h>
@@ -28,6 +41,172 @@
 namespace {
 dqrng::rng64_t rng = dqrng::generator(56478348);
 std::string rng_kind = "default";
+
+// Fill 'out' with variates from 'Dist' while recycling the parameter vectors.
+// The distribution object is reused, so any setup is only recomputed when the
+// parameters change from one element to the next.
+template<typename Dist, typename VEC, typename... Params>
+void generate_recycled(VEC& out, const Params&... params) {
+  if (out.length() == 0)
+    return;
+  for (R_xlen_t length : {params.length()...}) {
+    if (length == 0)
+      Rcpp::stop("Distribution parameters must not be empty!");
+  }
+  Dist dist(params[0]...);
+  if (std::max({params.length()...}) == 1) {
+    std::generate(out.begin(), out.end(), [&] {return dist(*rng);});
+    return;
+  }
+  for (R_xlen_t i = 0; i < out.length(); ++i) {
+    out[i] = dist(*rng, typename Dist::param_type(params[i % params.length()]...));
+  }
+}
+
+// Independent streams for 'threads' threads. The streams are seeded from a
+// fresh draw of the global RNG, so that consecutive calls do not overlap. All
+// streams are created before entering a parallel region, so that errors from
+// generators without stream support reach R.
+std::vector<std::unique_ptr<dqrng::random_64bit_generator>> parallel_streams(int threads) {
+  uint64_t seed = (*rng)();
+  std::vector<std::unique_ptr<dqrng::random_64bit_generator>> streams;
+  streams.reserve(threads);
+  for (int i = 0; i < threads; ++i) {
+    auto stream = rng->clone(0);
+    stream->seed(seed, i + 1);
+    streams.push_back(std::move(stream));
+  }
+  return streams;
+}
+
+// Fill [first, first + n) with standard normal variates using 'threads'
+// independent streams. The work is split by 'threads' independent of the
+// number of cores, so that the result is reproducible on every machine.
+void generate_normal_parallel(double* first, std::size_t n, int threads) {
+  if (threads <= 1) {
+    rng->generate<dqrng::standard_normal_distribution>(first, first + n);
+    return;
+  }
+  auto streams = parallel_streams(threads);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(std::min(threads, omp_get_num_procs())) schedule(static, 1)
+#endif
+  for (int i = 0; i < threads; ++i) {
+    std::size_t start = n / threads * i + std::min(n % threads, std::size_t(i));
+    std::size_t end = start + n / threads + (std::size_t(i) < n % threads ? 1 : 0);
+    streams[i]->generate<dqrng::standard_normal_distribution>(first + start, first + end);
+  }
+}
+
+// Write the permutations for the columns [first, last) of the n x B matrix
+// 'out'. All permutations are shuffled in the same scratch buffer: since the
+// Fisher-Yates shuffle yields a uniformly distributed permutation for any
+// input order, the buffer does not have to be reset between columns.
+void generate_permutations(dqrng::random_64bit_generator& prng, int* out, int n,
+                           std::size_t first, std::size_t last) {
+  std::vector<int> scratch(n);
+  std::iota(scratch.begin(), scratch.end(), 1);
+  for (std::size_t j = first; j < last; ++j) {
+    dqrng::sample::shuffle(prng, scratch.begin(), uint64_t(n));
+    std::copy(scratch.begin(), scratch.end(), out + j * n);
+  }
+}
+
+// Fill 'out' with variates from a finite mixture. The component labels for a
+// block are drawn from the alias table and sorted by component with a counting
+// sort. Each component then generates all its variates for the block in one
+// batch, which are scattered to their positions afterwards. Only
+// O(block size + K) additional memory is used.
+template<typename Dist>
+void generate_mixture(Rcpp::NumericVector& out, const dqrng::alias_table<uint32_t>& table,
+                      std::vector<Dist>& components) {
+  std::size_t k = components.size();
+  std::size_t block_size = std::min(std::max(std::size_t(4096), 4 * k), std::size_t(out.length()));
+  std::vector<uint32_t> label(block_size);
+  std::vector<uint32_t> position(block_size);
+  std::vector<double> buffer(block_size);
+  std::vector<std::size_t> offset(k + 1);
+  for (R_xlen_t start = 0; start < out.length(); start += block_size) {
+    std::size_t m = std::min(block_size, std::size_t(out.length() - start));
+    std::fill(offset.begin(), offset.end(), 0);
+    for (std::size_t i = 0; i < m; ++i) {
+      label[i] = table(*rng);
+      ++offset[label[i] + 1];
+    }
+    std::partial_sum(offset.begin(), offset.end(), offset.begin());
+    for (std::size_t i = 0; i < m; ++i)
+      position[offset[label[i]]++] = uint32_t(i);
+    // offset[c] is now the end of the group for component c
+    std::size_t begin = 0;
+    for (std::size_t c = 0; c < k; ++c) {
+      Dist& dist = components[c];
+      std::generate(buffer.begin() + begin, buffer.begin() + offset[c], [&] {return dist(*rng);});
+      begin = offset[c];
+    }
+    for (std::size_t j = 0; j < m; ++j)
+      out[start + position[j]] = buffer[j];
+  }
+}
+
+// Fill a vector of length 'n' with variates from a transformed distribution
+// using the block kernel. One transform is set up for every position within
+// the period of the recycled parameter vectors, so parameters are only
+// validated once.
+template<typename Transform, typename... Params>
+Rcpp::NumericVector generate_transformed(size_t n, const Params&... params) {
+  auto out = Rcpp::NumericVector(Rcpp::no_init(n));
+  if (n == 0)
+    return out;
+  R_xlen_t period = 1;
+  for (R_xlen_t length : {params.length()...}) {
+    if (length == 0)
+      Rcpp::stop("Distribution parameters must not be empty!");
+    // least common multiple, capped at n
+    R_xlen_t a = period, b = length;
+    while (b != 0) {
+      R_xlen_t t = a % b;
+      a = b;
+      b = t;
+    }
+    period = period / a > R_xlen_t(n) / length ? R_xlen_t(n) : std::min(period / a * length, R_xlen_t(n));
+  }
+  std::vector<Transform> transforms;
+  transforms.reserve(period);
+  for (R_xlen_t i = 0; i < period; ++i)
+    transforms.emplace_back(params[i % params.length()]...);
+  dqrng::generate_transformed(*rng, out.begin(), out.end(), transforms.begin(), transforms.end());
+  return out;
+}
+
+// Collect the edges of a random graph and return them as two column integer
+// matrix with 1-based vertex indices.
+class edge_list {
+private:
+  std::vector<int> from;
+  std::vector<int> to;
+
+public:
+  void reserve(double size) {
+    std::size_t capacity = std::size_t(std::min(size, double(std::numeric_limits<int>::max())));
+    from.reserve(capacity);
+    to.reserve(capacity);
+  }
+
+  void operator()(uint32_t w, uint32_t v) {
+    if (from.size() == std::size_t(std::numeric_limits<int>::max()))
+      Rcpp::stop("Number of edges must not exceed .Machine$integer.max!");
+    from.push_back(int(w) + 1);
+    to.push_back(int(v) + 1);
+  }
+
+  Rcpp::IntegerMatrix matrix() const {
+    int m = int(from.size());
+    Rcpp::IntegerMatrix out(Rcpp::no_init(m, 2));
+    std::copy(from.begin(), from.end(), out.begin());
+    std::copy(to.begin(), to.end(), out.begin() + m);
+    return out;
+  }
+};
 }
 
 // [[Rcpp::interfaces(r, cpp)]]
@@ -112,7 +291,26 @@ Rcpp::NumericVector dqrunif(size_t n, double min = 0.0, double max = 1.0) {
     return 2. * dqrunif(n, min/2., max/2.);
 
   auto out = Rcpp::NumericVector(Rcpp::no_init(n));
-  rng->generate<dqrng::uniform_distribution>(out, min, max);
+  if (min == 0.0 && max == 1.0)
+    rng->generate<dqrng::standard_uniform_distribution>(out);
+  else
+    rng->generate<dqrng::uniform_distribution>(out, min, max);
+  return out;
+}
+
+//' @rdname dqrng-functions
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrunif_antithetic(size_t n, double min = 0.0, double max = 1.0) {
+  if (min > max)
+    Rcpp::stop("Error: 'min' must not be larger than 'max'!");
+  if (min == max)
+    return Rcpp::NumericVector(n, min);
+  if(max / 2. - min / 2. > (std::numeric_limits<double>::max)() / 2.)
+    return 2. * dqrunif_antithetic(n, min/2., max/2.);
+
+  auto out = Rcpp::NumericVector(Rcpp::no_init(n));
+  dqrng::generate_antithetic(*rng, out.begin(), out.end(), dqrng::uniform_transform(min, max));
   return out;
 }
 
@@ -133,7 +331,19 @@ double runif(double min = 0.0, double max = 1.0) {
 // [[Rcpp::export(rng = false)]]
 Rcpp::NumericVector dqrnorm(size_t n, double mean = 0.0, double sd = 1.0) {
   auto out = Rcpp::NumericVector(Rcpp::no_init(n));
-  rng->generate<dqrng::normal_distribution>(out, mean, sd);
+  if (mean == 0.0 && sd == 1.0)
+    rng->generate<dqrng::standard_normal_distribution>(out);
+  else
+    rng->generate<dqrng::normal_distribution>(out, mean, sd);
+  return out;
+}
+
+//' @rdname dqrng-functions
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrnorm_antithetic(size_t n, double mean = 0.0, double sd = 1.0) {
+  auto out = Rcpp::NumericVector(Rcpp::no_init(n));
+  dqrng::generate_antithetic(*rng, out.begin(), out.end(), dqrng::normal_transform(mean, sd));
   return out;
 }
 
@@ -147,7 +357,10 @@ double rnorm(double mean = 0.0, double sd = 1.0) {
 // [[Rcpp::export(rng = false)]]
 Rcpp::NumericVector dqrexp(size_t n, double rate = 1.0) {
   auto out = Rcpp::NumericVector(Rcpp::no_init(n));
-  rng->generate<dqrng::exponential_distribution>(out, rate);
+  if (rate == 1.0)
+    rng->generate<dqrng::standard_exponential_distribution>(out);
+  else
+    rng->generate<dqrng::exponential_distribution>(out, rate);
   return out;
 }
 
@@ -156,6 +369,1144 @@ double rexp(double rate = 1.0) {
   return rng->variate<dqrng::exponential_distribution>(rate);;
 }
 
+//' @title Sorted uniform random numbers
+//'
+//' @description \code{dqrunif_sorted} generates uniformly distributed random
+//'   numbers in increasing order using the currently selected RNG.
+//'
+//' @param n  number of observations
+//'
+//' @return numeric vector of length \code{n} with sorted values in
+//'   \eqn{(0, 1)}
+//'
+//' @details The result has the same distribution as
+//'   \code{sort(dqrunif(n))} but is computed in \code{O(n)} time from
+//'   normalized cumulative sums of \code{n + 1} exponentially distributed
+//'   random numbers, which are written directly into the result vector. For
+//'   C++ code, \code{dqrng::sorted_uniform_iterator} provides the sorted
+//'   values one by one without storing them.
+//'
+//' @examples
+//' dqrunif_sorted(5)
+//'
+//' @rdname dqrunif_sorted
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrunif_sorted(size_t n) {
+  auto out = Rcpp::NumericVector(Rcpp::no_init(n));
+  dqrng::generate_sorted_uniform(*rng, out.begin(), out.end());
+  return out;
+}
+
+//' @title Quasi-random sequences
+//'
+//' @description \code{dqrsobol} and \code{dqrhalton} generate points from the
+//'   (randomized) Sobol and Halton low-discrepancy sequences. Randomization
+//'   uses the currently selected RNG.
+//'
+//' @param n  number of points
+//' @param d  number of dimensions; at most 3667 for \code{dqrsobol}
+//' @param scrambling  randomization of the Sobol sequence: \code{"owen"},
+//'   \code{"lms"} or \code{"none"}
+//' @param permute  should the digits of the Halton sequence be randomly
+//'   permuted?
+//' @param skip  index of the first point, e.g. for splitting the sequence
+//'   into chunks
+//'
+//' @return numeric \code{n x d} matrix where each row is a point in
+//'   \eqn{[0, 1)^d}
+//'
+//' @details \code{dqrsobol} uses the direction numbers by Joe and Kuo (2008)
+//'   with a resolution of 32 bits, so at most \code{2^32} points can be
+//'   generated. Consecutive points are computed with Gray code increments,
+//'   i.e. a single XOR per coordinate. With \code{scrambling = "owen"} the
+//'   points are randomized with nested uniform scrambling using the
+//'   hash-based approximation by Burley (2020). With \code{scrambling = "lms"}
+//'   random linear matrix scrambling (Matousek, 1998) and a random digital
+//'   shift are used. Scrambled points are centered in their cell of width
+//'   \code{2^-32} and hence lie in the open interval \eqn{(0, 1)}.
+//'
+//'   \code{dqrhalton} uses the first \code{d} primes as bases. With
+//'   \code{permute = TRUE} the digits in each dimension are permuted with a
+//'   random permutation that keeps zero fixed.
+//'
+//'   The randomization is drawn from the current RNG once per call. Points
+//'   from different chunks of the same sequence can be generated with
+//'   \code{skip} after restoring the RNG state, e.g. with
+//'   \code{\link{dqset.seed}}. The first point is computed directly from its
+//'   index.
+//'
+//' @seealso \code{vignette("cpp-api", package = "dqrng")} for the C++ classes
+//'   \code{dqrng::sobol_sequence} and \code{dqrng::halton_sequence}
+//'
+//' @examples
+//' dqset.seed(42)
+//' x <- dqrsobol(256, 2)
+//' plot(x)
+//'
+//' # the second half of the same randomized sequence
+//' dqset.seed(42)
+//' y <- dqrsobol(128, 2, skip = 128)
+//' all.equal(x[129:256, ], y)
+//'
+//' dqrhalton(5, 3, permute = FALSE)
+//'
+//' @rdname dqrsobol
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericMatrix dqrsobol(int n, int d, std::string scrambling = "owen", double skip = 0.0) {
+  if (!(n >= 0 && d > 0 && skip >= 0.0 && skip == std::floor(skip)))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && d > 0 && skip >= 0");
+  if (skip + n > double(dqrng::sobol_sequence::max_index))
+    Rcpp::stop("Sobol sequence supports at most 2^32 points!");
+  std::unique_ptr<dqrng::sobol_sequence> sequence;
+  if (scrambling == "none")
+    sequence.reset(new dqrng::sobol_sequence(d));
+  else if (scrambling == "owen")
+    sequence.reset(new dqrng::sobol_sequence(d, *rng, dqrng::sobol_sequence::owen));
+  else if (scrambling == "lms")
+    sequence.reset(new dqrng::sobol_sequence(d, *rng, dqrng::sobol_sequence::lms));
+  else
+    Rcpp::stop("Unknown scrambling: %s", scrambling);
+  sequence->seek(uint64_t(skip));
+  Rcpp::NumericMatrix out(Rcpp::no_init(n, d));
+  sequence->generate(out.begin(), n);
+  return out;
+}
+
+//' @rdname dqrsobol
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericMatrix dqrhalton(int n, int d, bool permute = true, double skip = 0.0) {
+  if (!(n >= 0 && d > 0 && skip >= 0.0 && skip == std::floor(skip) && skip + n <= 0x1.0p53))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && d > 0 && skip >= 0");
+  dqrng::halton_sequence sequence = permute ? dqrng::halton_sequence(d, *rng) : dqrng::halton_sequence(d);
+  sequence.seek(uint64_t(skip));
+  Rcpp::NumericMatrix out(Rcpp::no_init(n, d));
+  sequence.generate(out.begin(), n);
+  return out;
+}
+
+//' @title Latin hypercube and stratified sampling
+//'
+//' @description \code{dqrlhs} generates a random Latin hypercube design and
+//'   \code{dqrunif_stratified} stratified uniform random numbers using the
+//'   currently selected RNG.
+//'
+//' @param n  for \code{dqrlhs} the number of points; for
+//'   \code{dqrunif_stratified} the number of random numbers per stratum,
+//'   recycled to the number of strata
+//' @param d  number of dimensions
+//' @param breaks  increasing boundaries of the strata
+//'
+//' @return \code{dqrlhs} returns a numeric \code{n x d} matrix with values in
+//'   \eqn{[0, 1)}. \code{dqrunif_stratified} returns a numeric vector of length
+//'   \code{sum(n)}, with the values for the first stratum first.
+//'
+//' @details In a Latin hypercube design each column contains exactly one
+//'   value in each of the \code{n} intervals \eqn{[i/n, (i+1)/n)}. Every
+//'   column is generated in a single pass: the interval indices are shuffled
+//'   in place with the same Fisher-Yates shuffle as used by
+//'   \code{\link{dqsample.int}}, and a uniformly distributed jitter within the
+//'   interval is added as soon as an index is final.
+//'
+//'   \code{dqrunif_stratified} draws \code{n[j]} uniformly distributed random
+//'   numbers from each stratum \code{[breaks[j], breaks[j + 1])}.
+//'
+//' @examples
+//' x <- dqrlhs(10, 2)
+//' plot(x, xlim = c(0, 1), ylim = c(0, 1))
+//' abline(h = 0:10 / 10, v = 0:10 / 10, lty = 3)
+//'
+//' dqrunif_stratified(2, breaks = c(0, 0.5, 0.9, 1))
+//'
+//' @rdname dqrlhs
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericMatrix dqrlhs(int n, int d) {
+  if (!(n >= 0 && d >= 0))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && d >= 0");
+  Rcpp::NumericMatrix out(Rcpp::no_init(n, d));
+  for (int j = 0; j < d; ++j)
+    dqrng::generate_latin_hypercube_column(*rng, out.begin() + R_xlen_t(j) * n, uint32_t(n));
+  return out;
+}
+
+//' @rdname dqrlhs
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrunif_stratified(Rcpp::IntegerVector n, Rcpp::NumericVector breaks) {
+  R_xlen_t k = breaks.length() - 1;
+  if (k < 1 || n.length() == 0)
+    Rcpp::stop("Argument requirements not fulfilled: length(breaks) > 1 && length(n) > 0");
+  for (R_xlen_t j = 0; j < k; ++j) {
+    if (!(std::isfinite(breaks[j]) && std::isfinite(breaks[j + 1]) && breaks[j] < breaks[j + 1]))
+      Rcpp::stop("'breaks' must be finite and strictly increasing!");
+  }
+  std::vector<R_xlen_t> count(k);
+  R_xlen_t total = 0;
+  for (R_xlen_t j = 0; j < k; ++j) {
+    int c = n[j % n.length()];
+    if (c == NA_INTEGER || c < 0)
+      Rcpp::stop("'n' must be non-negative!");
+    count[j] = c;
+    total += c;
+  }
+  auto out = Rcpp::NumericVector(Rcpp::no_init(total));
+  dqrng::generate_stratified_uniform(*rng, out.begin(), breaks.begin(), breaks.end(), count.begin());
+  return out;
+}
+
+//' @title Brownian motion
+//'
+//' @description \code{dqrbrownian} and \code{dqrgbm} generate paths of
+//'   (arithmetic) Brownian motion and geometric Brownian motion using the
+//'   currently selected RNG.
+//'
+//' @param n_paths  number of paths
+//' @param n_steps  number of time steps per path
+//' @param dt  length of a time step
+//' @param drift  drift per unit time
+//' @param sigma  volatility, i.e. the standard deviation per square root of
+//'   unit time
+//' @param x0,s0  starting value of the paths
+//' @param bridge  should the Brownian bridge construction be used?
+//'
+//' @return numeric \code{(n_steps + 1) x n_paths} matrix where each column
+//'   contains one path at the times \code{0, dt, ..., n_steps * dt}
+//'
+//' @details \code{dqrbrownian} generates \eqn{X(t) = x_0 + \mu t + \sigma W(t)}{X(t) = x0 + drift * t + sigma * W(t)}
+//'   and \code{dqrgbm} generates
+//'   \eqn{S(t) = s_0 \exp((\mu - \sigma^2/2) t + \sigma W(t))}{S(t) = s0 * exp((drift - sigma^2/2) * t + sigma * W(t))},
+//'   where \eqn{W(t)} is a standard Wiener process.
+//'
+//'   By default each normally distributed increment is added to the running
+//'   sum as soon as it has been generated, so every path is written in a
+//'   single pass without temporary matrices. With \code{bridge = TRUE} the
+//'   final value of each path is drawn first and the intermediate points are
+//'   filled in by repeated bisection using the Brownian bridge. Both methods
+//'   result in the same distribution but use the random numbers in a
+//'   different order.
+//'
+//' @examples
+//' dqrbrownian(3, 5, dt = 0.1, sigma = 2)
+//' matplot(dqrgbm(5, 250, dt = 1/250, drift = 0.05, sigma = 0.2, s0 = 100),
+//'         type = "l", lty = 1)
+//'
+//' @rdname dqrbrownian
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericMatrix dqrbrownian(int n_paths, int n_steps, double dt = 1.0, double drift = 0.0,
+                                double sigma = 1.0, double x0 = 0.0, bool bridge = false) {
+  if (!(n_paths >= 0 && n_steps >= 0 && n_steps < INT_MAX))
+    Rcpp::stop("Argument requirements not fulfilled: n_paths >= 0 && n_steps >= 0");
+  dqrng::brownian_motion_distribution dist(n_steps, dt, drift, sigma, x0, bridge);
+  Rcpp::NumericMatrix out(Rcpp::no_init(n_steps + 1, n_paths));
+  for (int i = 0; i < n_paths; ++i)
+    dist(*rng, out.begin() + R_xlen_t(i) * (n_steps + 1));
+  return out;
+}
+
+//' @rdname dqrbrownian
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericMatrix dqrgbm(int n_paths, int n_steps, double dt = 1.0, double drift = 0.0,
+                           double sigma = 1.0, double s0 = 1.0, bool bridge = false) {
+  if (!(n_paths >= 0 && n_steps >= 0 && n_steps < INT_MAX))
+    Rcpp::stop("Argument requirements not fulfilled: n_paths >= 0 && n_steps >= 0");
+  if (!(s0 > 0.0 && std::isfinite(s0)))
+    Rcpp::stop("Geometric Brownian motion requires finite s0 > 0!");
+  // the logarithm is a Brownian motion, which is exponentiated while the
+  // column is still in cache
+  dqrng::brownian_motion_distribution dist(n_steps, dt, drift - 0.5 * sigma * sigma, sigma, std::log(s0), bridge);
+  Rcpp::NumericMatrix out(Rcpp::no_init(n_steps + 1, n_paths));
+  for (int i = 0; i < n_paths; ++i) {
+    auto first = out.begin() + R_xlen_t(i) * (n_steps + 1);
+    dist(*rng, first);
+    std::transform(first, first + n_steps + 1, first, [](double x) {return std::exp(x);});
+  }
+  return out;
+}
+
+//' @title Binomial distribution
+//'
+//' @description \code{dqrbinom} generates binomially distributed random
+//'   numbers using the currently selected RNG.
+//'
+//' @param n  number of observations
+//' @param size  number of trials; non-negative integers up to \code{.Machine$integer.max}
+//' @param prob  probability of success on each trial
+//'
+//' @return integer vector of length \code{n}
+//'
+//' @details The vectors \code{size} and \code{prob} are recycled to length
+//'   \code{n}. Inversion is used when \code{size * min(prob, 1 - prob) < 30}
+//'   and the BTPE algorithm by Kachitvichyanukul and Schmeiser (1988) otherwise.
+//'   The setup of these algorithms is reused for consecutive elements that
+//'   share the same parameters.
+//'
+//' @seealso \code{\link{rbinom}}
+//'
+//' @examples
+//' dqrbinom(5, size = 10, prob = 0.3)
+//' dqrbinom(5, size = c(10, 1e6), prob = 0.3)
+//'
+//' @rdname dqrbinom
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::IntegerVector dqrbinom(size_t n, Rcpp::NumericVector size, Rcpp::NumericVector prob) {
+  for (double s : size) {
+    if (!(s >= 0.0 && s <= INT_MAX && s == std::floor(s)))
+      Rcpp::stop("'size' must be a non-negative integer not larger than .Machine$integer.max!");
+  }
+  auto out = Rcpp::IntegerVector(Rcpp::no_init(n));
+  generate_recycled<dqrng::binomial_distribution>(out, size, prob);
+  return out;
+}
+
+//' @title Geometric and negative binomial distributions
+//'
+//' @description \code{dqrgeom} and \code{dqrnbinom} generate random numbers
+//'   from the geometric and negative binomial distribution using the currently
+//'   selected RNG.
+//'
+//' @param n  number of observations
+//' @param prob  probability of success in each trial
+//' @param size  target for number of successful trials; must be non-negative
+//' @param mu  alternative parametrization via mean
+//'
+//' @return numeric vector of length \code{n} containing the number of failures
+//'   before the first (\code{dqrgeom}) or \code{size}-th (\code{dqrnbinom})
+//'   success. A numeric instead of an integer vector is used, since the
+//'   values can be larger than \code{.Machine$integer.max}.
+//'
+//' @details The parameter vectors are recycled to length \code{n}. Exactly one
+//'   of \code{prob} and \code{mu} has to be specified for \code{dqrnbinom}.
+//'
+//'   \code{dqrgeom} uses inversion, i.e. \code{floor(log(u) / log(1 - prob))}
+//'   with a single uniform random number per draw. \code{dqrnbinom} uses the
+//'   gamma-Poisson mixture. The gamma variates are generated with the method
+//'   by Marsaglia and Tsang (2000) and the Poisson variates with the PTRD
+//'   algorithm by Hörmann (1993) as provided by \code{boost.random}.
+//'
+//' @seealso \code{\link{rgeom}} and \code{\link{rnbinom}}
+//'
+//' @examples
+//' dqrgeom(5, prob = 0.2)
+//' dqrnbinom(5, size = 3, prob = 0.2)
+//' dqrnbinom(5, size = 3, mu = 12)
+//'
+//' @rdname dqrgeom
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrgeom(size_t n, Rcpp::NumericVector prob) {
+  auto out = Rcpp::NumericVector(Rcpp::no_init(n));
+  generate_recycled<dqrng::geometric_distribution>(out, prob);
+  return out;
+}
+
+//' @rdname dqrgeom
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrnbinom(size_t n,
+                              Rcpp::NumericVector size,
+                              Rcpp::Nullable<Rcpp::NumericVector> prob = R_NilValue,
+                              Rcpp::Nullable<Rcpp::NumericVector> mu = R_NilValue) {
+  if (prob.isNotNull() == mu.isNotNull())
+    Rcpp::stop("Exactly one of 'prob' and 'mu' must be specified!");
+  auto out = Rcpp::NumericVector(Rcpp::no_init(n));
+  if (prob.isNotNull()) {
+    generate_recycled<dqrng::negative_binomial_distribution>(out, size, Rcpp::NumericVector(prob.get()));
+  } else {
+    Rcpp::NumericVector _mu(mu.get());
+    if (n == 0)
+      return out;
+    if (size.length() == 0 || _mu.length() == 0)
+      Rcpp::stop("Distribution parameters must not be empty!");
+    using param_type = dqrng::negative_binomial_distribution::param_type;
+    dqrng::negative_binomial_distribution dist;
+    for (size_t i = 0; i < n; ++i) {
+      double s = size[i % size.length()];
+      double m = _mu[i % _mu.length()];
+      if (!(m >= 0.0 && std::isfinite(m)))
+        Rcpp::stop("Negative binomial distribution requires finite mu >= 0");
+      out[i] = dist(*rng, param_type(s, m > 0.0 ? s / (s + m) : 1.0));
+    }
+  }
+  return out;
+}
+
+//' @title Zipf distribution
+//'
+//' @description \code{dqrzipf} generates random numbers from the Zipf
+//'   distribution on \code{1, ..., N} with probabilities proportional to
+//'   \code{k^-s} using the currently selected RNG.
+//'
+//' @param n  number of observations
+//' @param N  number of elements; must be an integer up to \code{2^53}
+//' @param s  non-negative exponent
+//'
+//' @return numeric vector of length \code{n}. A numeric instead of an integer
+//'   vector is used, since the values can be larger than
+//'   \code{.Machine$integer.max}.
+//'
+//' @details The parameter vectors are recycled to length \code{n}. The
+//'   rejection-inversion method by Hörmann and Derflinger (1996) is used,
+//'   which needs neither a table of size \code{N} nor a normalization
+//'   constant. Each draw takes \code{O(1)} expected time independent of
+//'   \code{N} and \code{s}. The setup is reused for consecutive elements that
+//'   share the same parameters.
+//'
+//' @examples
+//' dqrzipf(5, N = 10, s = 1)
+//' dqrzipf(5, N = 1e9, s = c(0.8, 1.2))
+//'
+//' @rdname dqrzipf
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrzipf(size_t n, Rcpp::NumericVector N, Rcpp::NumericVector s) {
+  auto out = Rcpp::NumericVector(Rcpp::no_init(n));
+  generate_recycled<dqrng::zipf_distribution>(out, N, s);
+  return out;
+}
+
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrmixture_family(size_t n,
+                                      Rcpp::NumericVector weights,
+                                      std::string family,
+                                      Rcpp::NumericVector param1,
+                                      Rcpp::NumericVector param2) {
+  R_xlen_t k = weights.length();
+  if (!(param1.length() == k && param2.length() == k))
+    Rcpp::stop("Argument requirements not fulfilled: length(param1) == length(param2) == length(weights)");
+  dqrng::alias_table<uint32_t> table(weights.begin(), weights.end());
+  auto out = Rcpp::NumericVector(Rcpp::no_init(n));
+  if (family == "normal") {
+    std::vector<dqrng::normal_distribution> components;
+    for (R_xlen_t i = 0; i < k; ++i) {
+      if (!(std::isfinite(param1[i]) && std::isfinite(param2[i]) && param2[i] >= 0.0))
+        Rcpp::stop("Normal mixture requires finite mean and sd >= 0!");
+      components.emplace_back(param1[i], param2[i]);
+    }
+    generate_mixture(out, table, components);
+  } else if (family == "exponential") {
+    std::vector<dqrng::exponential_distribution> components;
+    for (R_xlen_t i = 0; i < k; ++i) {
+      if (!(std::isfinite(param1[i]) && param1[i] > 0.0))
+        Rcpp::stop("Exponential mixture requires finite rate > 0!");
+      components.emplace_back(param1[i]);
+    }
+    generate_mixture(out, table, components);
+  } else if (family == "gamma") {
+    std::vector<dqrng::gamma_distribution> components;
+    for (R_xlen_t i = 0; i < k; ++i)
+      components.emplace_back(param1[i], param2[i]);
+    generate_mixture(out, table, components);
+  } else {
+    Rcpp::stop("Unknown mixture family: %s", family);
+  }
+  return out;
+}
+
+// [[Rcpp::export(rng = false)]]
+Rcpp::List dqrsparse_pattern(int nrow, int ncol, double density) {
+  if (!(nrow >= 0 && ncol >= 0 && density >= 0.0 && density <= 1.0))
+    Rcpp::stop("Argument requirements not fulfilled: nrow >= 0 && ncol >= 0 && 0 <= density <= 1");
+  double size = double(nrow) * double(ncol);
+  if (size > 0x1.0p53)
+    Rcpp::stop("Sparse matrices support at most 2^53 entries!");
+  double expected = size * density;
+  double reserve = std::min(expected + 5.0 * std::sqrt(expected) + 1.0, size);
+  if (reserve > double(std::numeric_limits<int>::max()))
+    Rcpp::stop("Number of non-zero entries must not exceed .Machine$integer.max!");
+  std::vector<int> i;
+  i.reserve(std::size_t(reserve));
+  Rcpp::IntegerVector p(ncol + 1);
+  // the linear indices arrive in column major order, so the row indices are
+  // sorted within each column and the column pointers can be filled directly
+  int col = 0;
+  double col_end = nrow;
+  dqrng::for_each_bernoulli_index(*rng, size, density, [&](double k) {
+    while (k >= col_end) {
+      p[++col] = int(i.size());
+      col_end += nrow;
+    }
+    if (i.size() == std::size_t(std::numeric_limits<int>::max()))
+      Rcpp::stop("Number of non-zero entries must not exceed .Machine$integer.max!");
+    i.push_back(int(k - (col_end - nrow)));
+  });
+  while (col < ncol)
+    p[++col] = int(i.size());
+  return Rcpp::List::create(Rcpp::Named("i") = Rcpp::wrap(i), Rcpp::Named("p") = p);
+}
+
+//' @title Random graphs
+//'
+//' @description \code{dqrgraph_gnp} and \code{dqrgraph_gnm} generate
+//'   Erdős–Rényi random graphs, \code{dqrgraph_sbm} graphs from a stochastic
+//'   block model using the currently selected RNG. All graphs are undirected
+//'   without loops or multiple edges.
+//'
+//' @param n  number of vertices
+//' @param p  probability for each edge to be present
+//' @param m  number of edges
+//' @param block_sizes  integer vector with the number of vertices in each block
+//' @param prob  symmetric matrix with the edge probabilities between and
+//'   within the blocks
+//'
+//' @return integer matrix with two columns where each row contains the
+//'   vertices of one edge, with the smaller index in the first column. The
+//'   vertices are numbered from \code{1} to \code{n} or
+//'   \code{sum(block_sizes)}, with the vertices of each block following those
+//'   of the previous block.
+//'
+//' @details The \code{n * (n - 1) / 2} possible edges are indexed in
+//'   lexicographic order of the larger and smaller vertex. \code{dqrgraph_gnp}
+//'   draws the gaps between the present edges from the geometric distribution
+//'   as proposed by Batagelj and Brandes (2005), so the cost is proportional to
+//'   the number of vertices and edges. \code{dqrgraph_gnm} samples \code{m}
+//'   edge indices without replacement with the same methods as
+//'   \code{\link{dqsample}} and converts them to vertex pairs. The edges are
+//'   returned in random order. \code{dqrgraph_sbm} uses geometric skipping
+//'   within each pair of blocks.
+//'
+//'   The number of possible edges must not exceed \code{2^53}.
+//'
+//' @seealso \code{sample_gnp}, \code{sample_gnm} and \code{sample_sbm} in package
+//'   \pkg{igraph}
+//'
+//' @examples
+//' dqrgraph_gnp(10, 0.2)
+//' dqrgraph_gnm(10, 5)
+//' prob <- matrix(c(0.5, 0.01, 0.01, 0.5), ncol = 2)
+//' edges <- dqrgraph_sbm(c(20, 30), prob)
+//' table((edges[, 1] > 20) + (edges[, 2] > 20))
+//'
+//' @rdname dqrgraph
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::IntegerMatrix dqrgraph_gnp(int n, double p) {
+  if (!(n >= 0 && p >= 0.0 && p <= 1.0))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && 0 <= p <= 1");
+  edge_list edges;
+  double pairs = dqrng::graph::number_of_pairs(n);
+  edges.reserve(pairs * p + 5.0 * std::sqrt(pairs * p) + 1.0);
+  dqrng::graph::gnp(*rng, n, p, [&edges](uint32_t w, uint32_t v) {edges(w, v);});
+  return edges.matrix();
+}
+
+//' @rdname dqrgraph
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::IntegerMatrix dqrgraph_gnm(int n, double m) {
+  if (!(n >= 0 && m >= 0.0 && m == std::floor(m)))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && m >= 0");
+  if (m > dqrng::graph::number_of_pairs(n))
+    Rcpp::stop("'m' must not exceed the number of vertex pairs!");
+  if (m > double(std::numeric_limits<int>::max()))
+    Rcpp::stop("Number of edges must not exceed .Machine$integer.max!");
+  edge_list edges;
+  edges.reserve(m);
+  dqrng::graph::gnm(*rng, n, uint64_t(m), [&edges](uint32_t w, uint32_t v) {edges(w, v);});
+  return edges.matrix();
+}
+
+//' @rdname dqrgraph
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::IntegerMatrix dqrgraph_sbm(Rcpp::IntegerVector block_sizes, Rcpp::NumericMatrix prob) {
+  R_xlen_t k = block_sizes.length();
+  if (!(prob.nrow() == k && prob.ncol() == k))
+    Rcpp::stop("Argument requirements not fulfilled: nrow(prob) == ncol(prob) == length(block_sizes)");
+  std::vector<uint32_t> size(k);
+  double total = 0.0;
+  for (R_xlen_t r = 0; r < k; ++r) {
+    if (!(block_sizes[r] >= 0))
+      Rcpp::stop("'block_sizes' must be non-negative!");
+    size[r] = uint32_t(block_sizes[r]);
+    total += block_sizes[r];
+  }
+  // vertex ids are returned as int
+  if (total > double(std::numeric_limits<int>::max()))
+    Rcpp::stop("Number of vertices must not exceed .Machine$integer.max!");
+  std::vector<double> p(prob.begin(), prob.end());
+  double expected = 0.0;
+  for (R_xlen_t s = 0; s < k; ++s) {
+    if (!(p[s + k * s] >= 0.0 && p[s + k * s] <= 1.0))
+      Rcpp::stop("'prob' must contain probabilities!");
+    expected += p[s + k * s] * size[s] * (size[s] - 1.0) / 2.0;
+    for (R_xlen_t r = 0; r < s; ++r)
+      expected += p[r + k * s] * size[r] * size[s];
+  }
+  edge_list edges;
+  edges.reserve(expected + 5.0 * std::sqrt(expected) + 1.0);
+  dqrng::graph::sbm(*rng, size, p, [&edges](uint32_t w, uint32_t v) {edges(w, v);});
+  return edges.matrix();
+}
+
+//' @title Multinomial distribution
+//'
+//' @description \code{dqrmultinom} generates multinomially distributed
+//'   random vectors using the currently selected RNG.
+//'
+//' @param n  number of random vectors to draw
+//' @param size  total number of objects that are put into \code{K} boxes
+//' @param prob  numeric non-negative vector of length \code{K}, specifying the
+//'   probability for the \code{K} classes; is internally normalized to sum 1
+//'
+//' @return integer \code{K x n} matrix where each column is a random vector
+//'   generated according to the desired multinomial law
+//'
+//' @details The counts are generated with the conditional binomial method,
+//'   i.e. the count of each class is drawn from a binomial distribution for
+//'   the objects not yet assigned. The conditional probabilities are computed
+//'   only once for all \code{n} vectors, and once all objects have been assigned
+//'   the remaining classes are set to zero. This makes the method suitable for
+//'   a large number of classes.
+//'
+//' @seealso \code{\link{rmultinom}}
+//'
+//' @examples
+//' dqrmultinom(5, size = 100, prob = c(0.2, 0.3, 0.5))
+//'
+//' @rdname dqrmultinom
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::IntegerMatrix dqrmultinom(int n, int size, Rcpp::NumericVector prob) {
+  if (!(n >= 0 && size >= 0))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && size >= 0");
+  dqrng::multinomial_distribution dist(size, prob.begin(), prob.end());
+  R_xlen_t k = prob.length();
+  Rcpp::IntegerMatrix out(Rcpp::no_init(k, n));
+  for (int i = 0; i < n; ++i)
+    dist(*rng, out.begin() + i * k);
+  if (prob.hasAttribute("names"))
+    out.attr("dimnames") = Rcpp::List::create(prob.names(), R_NilValue);
+  return out;
+}
+
+//' @title Truncated normal distribution
+//'
+//' @description \code{dqrtnorm} generates random numbers from the normal
+//'   distribution truncated to the interval \code{[lower, upper]} using the
+//'   currently selected RNG.
+//'
+//' @param n  number of observations
+//' @param mean  mean of the untruncated normal distribution
+//' @param sd  standard deviation of the untruncated normal distribution
+//' @param lower,upper  bounds of the interval; may be infinite
+//'
+//' @return numeric vector of length \code{n}
+//'
+//' @details All parameter vectors are recycled to length \code{n}. For each
+//'   element the method is chosen depending on the standardized interval:
+//'   normal rejection using the Ziggurat algorithm for wide intervals
+//'   containing the mean, uniform rejection for narrow intervals, half-normal
+//'   rejection for intervals starting close to the mean and exponential
+//'   rejection with optimal rate (Robert, 1995) for the tails. The thresholds
+//'   follow Li and Ghosh (2015). The choice is reused for consecutive elements
+//'   that share the same parameters.
+//'
+//' @examples
+//' dqrtnorm(5, mean = 0, sd = 1, lower = 0, upper = Inf)
+//' dqrtnorm(5, mean = 1, sd = 2, lower = c(-Inf, 10), upper = c(0, Inf))
+//'
+//' @rdname dqrtnorm
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrtnorm(size_t n,
+                             Rcpp::NumericVector mean,
+                             Rcpp::NumericVector sd,
+                             Rcpp::NumericVector lower,
+                             Rcpp::NumericVector upper) {
+  auto out = Rcpp::NumericVector(Rcpp::no_init(n));
+  generate_recycled<dqrng::truncated_normal_distribution>(out, mean, sd, lower, upper);
+  return out;
+}
+
+//' @title Distributions obtained by transformation
+//'
+//' @description Random numbers from the lognormal, Weibull, Cauchy, logistic,
+//'   Gumbel and Laplace distribution using the currently selected RNG.
+//'
+//' @param n  number of observations
+//' @param meanlog,sdlog  mean and standard deviation of the distribution on
+//'   the log scale
+//' @param shape,scale  shape and scale parameters
+//' @param location  location parameter
+//'
+//' @return numeric vector of length \code{n}
+//'
+//' @details All parameter vectors are recycled to length \code{n}.
+//'   \code{dqrlnorm} transforms normally distributed random numbers, while the
+//'   other functions use inversion of uniform random numbers in the open
+//'   interval \eqn{(0, 1)}. The Gumbel distribution has the distribution
+//'   function \eqn{F(x) = \exp(-\exp(-(x - \mu)/\beta))}{F(x) = exp(-exp(-(x - location)/scale))}
+//'   and the Laplace distribution the density
+//'   \eqn{f(x) = \exp(-|x - \mu|/\beta)/(2\beta)}{f(x) = exp(-|x - location|/scale)/(2 scale)}.
+//'
+//'   The base random numbers are generated in blocks and the transformation is
+//'   applied to the whole block in a separate loop, which avoids temporary
+//'   vectors and allows the compiler to vectorize the transformation.
+//'
+//' @seealso \code{\link{rlnorm}}, \code{\link{rweibull}}, \code{\link{rcauchy}}
+//'   and \code{\link{rlogis}}
+//'
+//' @examples
+//' dqrlnorm(5, meanlog = 1, sdlog = 0.5)
+//' dqrweibull(5, shape = 2, scale = c(1, 10))
+//' dqrcauchy(5)
+//' dqrlogis(5, location = 1)
+//' dqrgumbel(5, location = 1, scale = 2)
+//' dqrlaplace(5, scale = 0.5)
+//'
+//' @rdname dqrlnorm
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrlnorm(size_t n,
+                             Rcpp::NumericVector meanlog = Rcpp::NumericVector::create(0.0),
+                             Rcpp::NumericVector sdlog = Rcpp::NumericVector::create(1.0)) {
+  return generate_transformed<dqrng::lognormal_transform>(n, meanlog, sdlog);
+}
+
+//' @rdname dqrlnorm
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrweibull(size_t n,
+                               Rcpp::NumericVector shape,
+                               Rcpp::NumericVector scale = Rcpp::NumericVector::create(1.0)) {
+  return generate_transformed<dqrng::weibull_transform>(n, shape, scale);
+}
+
+//' @rdname dqrlnorm
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrcauchy(size_t n,
+                              Rcpp::NumericVector location = Rcpp::NumericVector::create(0.0),
+                              Rcpp::NumericVector scale = Rcpp::NumericVector::create(1.0)) {
+  return generate_transformed<dqrng::cauchy_transform>(n, location, scale);
+}
+
+//' @rdname dqrlnorm
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrlogis(size_t n,
+                             Rcpp::NumericVector location = Rcpp::NumericVector::create(0.0),
+                             Rcpp::NumericVector scale = Rcpp::NumericVector::create(1.0)) {
+  return generate_transformed<dqrng::logistic_transform>(n, location, scale);
+}
+
+//' @rdname dqrlnorm
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrgumbel(size_t n,
+                              Rcpp::NumericVector location = Rcpp::NumericVector::create(0.0),
+                              Rcpp::NumericVector scale = Rcpp::NumericVector::create(1.0)) {
+  return generate_transformed<dqrng::gumbel_transform>(n, location, scale);
+}
+
+//' @rdname dqrlnorm
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrlaplace(size_t n,
+                               Rcpp::NumericVector location = Rcpp::NumericVector::create(0.0),
+                               Rcpp::NumericVector scale = Rcpp::NumericVector::create(1.0)) {
+  return generate_transformed<dqrng::laplace_transform>(n, location, scale);
+}
+
+//' @title Circular distributions
+//'
+//' @description \code{dqrvonmises}, \code{dqrwrappednorm} and
+//'   \code{dqrwrappedcauchy} generate random angles from the von Mises, the
+//'   wrapped normal and the wrapped Cauchy distribution using the currently
+//'   selected RNG.
+//'
+//' @param n  number of observations
+//' @param mu  mean direction
+//' @param kappa  non-negative concentration parameter
+//' @param sd  standard deviation of the normal distribution before wrapping
+//' @param rho  mean resultant length with \code{0 <= rho < 1}
+//'
+//' @return numeric vector of length \code{n} with values in \eqn{[0, 2\pi)}
+//'
+//' @details All parameter vectors are recycled to length \code{n}.
+//'   \code{dqrvonmises} uses the rejection algorithm by Best and Fisher
+//'   (1979). The proposal is computed from the upper bits of a single 64 bit
+//'   random number, whose remaining bits determine the sign of the angle. The
+//'   setup is reused for consecutive elements that share the same parameters.
+//'   For \code{kappa = 0} uniformly distributed angles are returned, while for
+//'   very large \code{kappa > 1e6} the wrapped normal approximation with
+//'   standard deviation \code{1/sqrt(kappa)} is used.
+//'
+//'   \code{dqrwrappednorm} and \code{dqrwrappedcauchy} transform normal and
+//'   uniform random numbers with the same block kernel as
+//'   \code{\link{dqrlnorm}}.
+//'
+//' @examples
+//' dqrvonmises(5, mu = pi, kappa = 2)
+//' dqrwrappednorm(5, mu = 0, sd = c(0.1, 1))
+//' dqrwrappedcauchy(5, mu = pi / 2, rho = 0.9)
+//'
+//' @rdname dqrvonmises
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrvonmises(size_t n, Rcpp::NumericVector mu, Rcpp::NumericVector kappa) {
+  auto out = Rcpp::NumericVector(Rcpp::no_init(n));
+  generate_recycled<dqrng::von_mises_distribution>(out, mu, kappa);
+  return out;
+}
+
+//' @rdname dqrvonmises
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrwrappednorm(size_t n, Rcpp::NumericVector mu, Rcpp::NumericVector sd) {
+  return generate_transformed<dqrng::wrapped_normal_transform>(n, mu, sd);
+}
+
+//' @rdname dqrvonmises
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrwrappedcauchy(size_t n, Rcpp::NumericVector mu, Rcpp::NumericVector rho) {
+  return generate_transformed<dqrng::wrapped_cauchy_transform>(n, mu, rho);
+}
+
+//' @title Hypergeometric distribution
+//'
+//' @description \code{dqrhyper} generates random numbers from the
+//'   hypergeometric distribution and \code{dqrmvhyper} random vectors from the
+//'   multivariate hypergeometric distribution using the currently selected RNG.
+//'
+//' @param nn  number of observations
+//' @param m  the number of white balls in the urn
+//' @param n  the number of black balls in the urn; number of random vectors to
+//'   draw for \code{dqrmvhyper}
+//' @param k  the number of balls drawn from the urn
+//'
+//' @return \code{dqrhyper} returns an integer vector of length \code{nn} with
+//'   the number of white balls drawn. \code{dqrmvhyper} returns an integer
+//'   \code{K x n} matrix where each column contains the number of balls drawn
+//'   for each of the \code{K = length(m)} colors.
+//'
+//' @details For \code{dqrhyper} the vectors \code{m}, \code{n} and \code{k}
+//'   are recycled to length \code{nn}. All of them must contain non-negative
+//'   integers up to \code{.Machine$integer.max}. Inversion is used when the
+//'   mode of the distribution is close to its lower bound and the H2PE
+//'   algorithm by Kachitvichyanukul and Schmeiser (1985) otherwise. As for
+//'   \code{\link{dqrbinom}}, the setup is reused for consecutive elements that
+//'   share the same parameters.
+//'
+//'   For \code{dqrmvhyper} the vector \code{m} contains the number of balls of
+//'   each color. The counts are generated color by color from univariate
+//'   hypergeometric distributions for the balls not yet drawn, so only
+//'   \code{O(K)} additional memory is needed. Once \code{k} balls have been
+//'   drawn the remaining colors are set to zero.
+//'
+//' @seealso \code{\link{rhyper}}
+//'
+//' @examples
+//' dqrhyper(5, m = 10, n = 7, k = 8)
+//' dqrhyper(5, m = c(10, 1e6), n = 1e6, k = 1000)
+//' dqrmvhyper(5, m = c(red = 10, green = 20, blue = 30), k = 15)
+//'
+//' @rdname dqrhyper
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::IntegerVector dqrhyper(size_t nn, Rcpp::NumericVector m, Rcpp::NumericVector n, Rcpp::NumericVector k) {
+  for (const Rcpp::NumericVector& param : {m, n, k}) {
+    for (double x : param) {
+      if (!(x >= 0.0 && x <= INT_MAX && x == std::floor(x)))
+        Rcpp::stop("'m', 'n' and 'k' must be non-negative integers not larger than .Machine$integer.max!");
+    }
+  }
+  auto out = Rcpp::IntegerVector(Rcpp::no_init(nn));
+  generate_recycled<dqrng::hypergeometric_distribution>(out, m, n, k);
+  return out;
+}
+
+//' @rdname dqrhyper
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::IntegerMatrix dqrmvhyper(int n, Rcpp::NumericVector m, int k) {
+  if (!(n >= 0 && k >= 0))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && k >= 0");
+  for (double x : m) {
+    if (!(x >= 0.0 && x <= INT_MAX && x == std::floor(x)))
+      Rcpp::stop("'m' must contain non-negative integers not larger than .Machine$integer.max!");
+  }
+  dqrng::multivariate_hypergeometric_distribution dist(m.begin(), m.end(), k);
+  R_xlen_t K = m.length();
+  Rcpp::IntegerMatrix out(Rcpp::no_init(K, n));
+  for (int i = 0; i < n; ++i)
+    dist(*rng, out.begin() + i * K);
+  if (m.hasAttribute("names"))
+    out.attr("dimnames") = Rcpp::List::create(m.names(), R_NilValue);
+  return out;
+}
+
+//' @title Dirichlet distribution
+//'
+//' @description \code{dqrdirichlet} generates random vectors from the
+//'   Dirichlet distribution using the currently selected RNG.
+//'
+//' @param n  number of random vectors to draw
+//' @param alpha  non-negative concentration parameters of length \code{K}
+//'
+//' @return numeric \code{n x K} matrix where each row is a random vector
+//'   with non-negative entries summing to one
+//'
+//' @details Each row is generated from independent gamma variates, which are
+//'   written directly into the result matrix and normalized afterwards. If
+//'   all \code{alpha} are equal to one, i.e. for uniformly distributed points
+//'   on the simplex, exponential random numbers generated with the Ziggurat
+//'   algorithm are used instead. For \code{alpha < 1} the gamma variates are
+//'   computed on the log scale to avoid underflow. Components with
+//'   \code{alpha == 0} are always zero.
+//'
+//' @examples
+//' dqrdirichlet(5, alpha = c(a = 1, b = 2, c = 3))
+//' rowSums(dqrdirichlet(5, alpha = rep(1, 10)))
+//'
+//' @rdname dqrdirichlet
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericMatrix dqrdirichlet(int n, Rcpp::NumericVector alpha) {
+  if (!(n >= 0))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0");
+  dqrng::dirichlet_distribution dist(alpha.begin(), alpha.end());
+  R_xlen_t k = alpha.length();
+  Rcpp::NumericMatrix out(Rcpp::no_init(n, k));
+  for (int i = 0; i < n; ++i)
+    dist(*rng, out.begin() + i, n);
+  if (alpha.hasAttribute("names"))
+    out.attr("dimnames") = Rcpp::List::create(R_NilValue, alpha.names());
+  return out;
+}
+
+//' @title Wishart and inverse Wishart distribution
+//'
+//' @description \code{dqrwishart} and \code{dqrinvwishart} generate random
+//'   matrices from the Wishart and inverse Wishart distribution using the
+//'   currently selected RNG.
+//'
+//' @param n  number of random matrices to draw
+//' @param df  degrees of freedom; must be larger than \code{p - 1}
+//' @param Sigma  positive definite \code{p x p} scale matrix; only the lower
+//'   triangle is used
+//'
+//' @return numeric \code{p x p x n} array where each slice is a random
+//'   matrix, as for \code{\link{rWishart}}
+//'
+//' @details The matrices are generated with the Bartlett decomposition
+//'   \eqn{W = L A A^T L^T}, where \eqn{L} is the Cholesky factor of
+//'   \code{Sigma} and \eqn{A} is lower triangular with chi-distributed
+//'   diagonal and standard normal entries below the diagonal. The Cholesky
+//'   factor is computed only once for all \code{n} matrices.
+//'
+//'   For \code{dqrinvwishart} the Wishart matrix is drawn with scale matrix
+//'   \code{solve(Sigma)} and inverted using the inverse of the triangular
+//'   factor \eqn{L A}, so that the mean is \code{Sigma / (df - p - 1)}.
+//'
+//' @seealso \code{\link{rWishart}}
+//'
+//' @examples
+//' Sigma <- matrix(c(4, 2, 2, 3), ncol = 2)
+//' dqrwishart(2, df = 5, Sigma = Sigma)
+//' dqrinvwishart(2, df = 5, Sigma = Sigma)
+//'
+//' @rdname dqrwishart
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrwishart(int n, double df, Rcpp::NumericMatrix Sigma) {
+  if (!(n >= 0 && Sigma.nrow() == Sigma.ncol()))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && nrow(Sigma) == ncol(Sigma)");
+  dqrng::wishart_distribution dist(df, Sigma.begin(), Sigma.end());
+  R_xlen_t p = Sigma.nrow();
+  Rcpp::NumericVector out(Rcpp::no_init(p * p * n));
+  for (int i = 0; i < n; ++i)
+    dist(*rng, out.begin() + i * p * p);
+  out.attr("dim") = Rcpp::Dimension(p, p, n);
+  return out;
+}
+
+//' @rdname dqrwishart
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrinvwishart(int n, double df, Rcpp::NumericMatrix Sigma) {
+  if (!(n >= 0 && Sigma.nrow() == Sigma.ncol()))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && nrow(Sigma) == ncol(Sigma)");
+  dqrng::wishart_distribution dist(df, Sigma.begin(), Sigma.end(), true);
+  R_xlen_t p = Sigma.nrow();
+  Rcpp::NumericVector out(Rcpp::no_init(p * p * n));
+  for (int i = 0; i < n; ++i)
+    dist(*rng, out.begin() + i * p * p);
+  out.attr("dim") = Rcpp::Dimension(p, p, n);
+  return out;
+}
+
+//' @title Uniform distribution on sphere, ball and simplex
+//'
+//' @description \code{dqrsphere}, \code{dqrball} and \code{dqrsimplex}
+//'   generate uniformly distributed points on the unit sphere, in the unit
+//'   ball and on the standard simplex using the currently selected RNG.
+//'
+//' @param n  number of points to draw
+//' @param d  dimension of the space
+//'
+//' @return numeric \code{n x d} matrix where each row is a random point
+//'
+//' @details Points on the sphere \eqn{\{x: |x| = 1\}} are generated as
+//'   normalized vectors of standard normal random numbers. For the ball
+//'   \eqn{\{x: |x| \le 1\}} these are scaled with the radius \eqn{U^{1/d}}.
+//'   Points on the simplex \eqn{\{x: x_i \ge 0, \sum x_i = 1\}} are generated
+//'   as normalized exponential random numbers, which is equivalent to the
+//'   spacings of sorted uniform random numbers. Each row is generated
+//'   directly in the result matrix in a single pass.
+//'
+//' @examples
+//' x <- dqrsphere(5, d = 3)
+//' rowSums(x^2)
+//' dqrball(5, d = 2)
+//' rowSums(dqrsimplex(5, d = 4))
+//'
+//' @rdname dqrsphere
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericMatrix dqrsphere(int n, int d) {
+  if (!(n >= 0 && d > 0))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && d > 0");
+  dqrng::sphere_distribution dist(d);
+  Rcpp::NumericMatrix out(Rcpp::no_init(n, d));
+  for (int i = 0; i < n; ++i)
+    dist(*rng, out.begin() + i, n);
+  return out;
+}
+
+//' @rdname dqrsphere
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericMatrix dqrball(int n, int d) {
+  if (!(n >= 0 && d > 0))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && d > 0");
+  dqrng::ball_distribution dist(d);
+  Rcpp::NumericMatrix out(Rcpp::no_init(n, d));
+  for (int i = 0; i < n; ++i)
+    dist(*rng, out.begin() + i, n);
+  return out;
+}
+
+//' @rdname dqrsphere
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericMatrix dqrsimplex(int n, int d) {
+  if (!(n >= 0 && d > 0))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && d > 0");
+  dqrng::simplex_distribution dist(d);
+  Rcpp::NumericMatrix out(Rcpp::no_init(n, d));
+  for (int i = 0; i < n; ++i)
+    dist(*rng, out.begin() + i, n);
+  return out;
+}
+
+//' @title Random orthogonal and rotation matrices
+//'
+//' @description \code{dqrorthogonal} generates random orthogonal matrices
+//'   and \code{dqrrotation} random rotation matrices uniformly distributed
+//'   with respect to the Haar measure using the currently selected RNG.
+//'
+//' @param n  number of random matrices to draw
+//' @param d  dimension of the matrices
+//'
+//' @return numeric \code{d x d x n} array where each slice is a random
+//'   matrix
+//'
+//' @details A matrix with standard normal entries is decomposed with the
+//'   Householder QR decomposition. The orthogonal factor \eqn{Q} multiplied
+//'   with the signs of the diagonal of \eqn{R} is Haar distributed on the
+//'   orthogonal group (Mezzadri, 2007). For \code{dqrrotation} the sign of
+//'   the first column is flipped if the determinant is negative, which gives
+//'   Haar distributed matrices on the special orthogonal group, i.e. matrices
+//'   with determinant \eqn{+1}.
+//'
+//' @examples
+//' q <- dqrorthogonal(1, d = 3)[, , 1]
+//' zapsmall(crossprod(q))
+//' det(dqrrotation(1, d = 3)[, , 1])
+//'
+//' @rdname dqrorthogonal
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrorthogonal(int n, int d) {
+  if (!(n >= 0 && d > 0))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && d > 0");
+  dqrng::orthogonal_matrix_distribution dist(d);
+  R_xlen_t size = R_xlen_t(d) * d;
+  Rcpp::NumericVector out(Rcpp::no_init(size * n));
+  for (int i = 0; i < n; ++i)
+    dist(*rng, out.begin() + i * size);
+  out.attr("dim") = Rcpp::Dimension(d, d, n);
+  return out;
+}
+
+//' @rdname dqrorthogonal
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqrrotation(int n, int d) {
+  if (!(n >= 0 && d > 0))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && d > 0");
+  dqrng::orthogonal_matrix_distribution dist(d, true);
+  R_xlen_t size = R_xlen_t(d) * d;
+  Rcpp::NumericVector out(Rcpp::no_init(size * n));
+  for (int i = 0; i < n; ++i)
+    dist(*rng, out.begin() + i * size);
+  out.attr("dim") = Rcpp::Dimension(d, d, n);
+  return out;
+}
+
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericMatrix dqrmvnorm_chol(int n,
+                                   Rcpp::NumericVector mean,
+                                   Rcpp::NumericMatrix root,
+                                   Rcpp::IntegerVector pivot,
+                                   int threads = 1) {
+  int d = root.nrow();
+  if (!(n >= 0 && root.ncol() == d && mean.length() == d && pivot.length() == d))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && length(mean) == length(pivot) == nrow(root) == ncol(root)");
+  Rcpp::NumericMatrix out(Rcpp::no_init(n, d));
+  if (n == 0 || d == 0)
+    return out;
+  // standard normal variates are written directly into the result matrix ...
+  generate_normal_parallel(out.begin(), std::size_t(n) * d, threads);
+  // ... which is multiplied in place with the upper triangular root
+  double one = 1.0;
+  F77_CALL(dtrmm)("R", "U", "N", "N", &n, &d, &one, root.begin(), &d, out.begin(), &n
+                  FCONE FCONE FCONE FCONE);
+  // undo the pivoting of the Cholesky decomposition by following the
+  // cycles of the permutation, then add the mean
+  std::vector<bool> done(d, false);
+  std::vector<double> tmp(n);
+  for (int j = 0; j < d; ++j) {
+    if (done[j])
+      continue;
+    done[j] = true;
+    if (pivot[j] - 1 == j)
+      continue;
+    std::copy(out.begin() + R_xlen_t(j) * n, out.begin() + R_xlen_t(j + 1) * n, tmp.begin());
+    int k = j;
+    do {
+      k = pivot[k] - 1;
+      done[k] = true;
+      std::swap_ranges(tmp.begin(), tmp.end(), out.begin() + R_xlen_t(k) * n);
+    } while (k != j);
+  }
+  for (int j = 0; j < d; ++j) {
+    double m = mean[j];
+    if (m != 0.0)
+      std::for_each(out.begin() + R_xlen_t(j) * n, out.begin() + R_xlen_t(j + 1) * n,
+                    [m] (double& x) {x += m;});
+  }
+  return out;
+}
+
 //' @keywords internal
 // [[Rcpp::export(rng = false)]]
 Rcpp::XPtr<dqrng::random_64bit_generator> get_rng() {
@@ -192,6 +1543,14 @@ Rcpp::IntegerVector dqsample_int(int n,
                                  int offset = 0) {
     if (!(n > 0 && size >= 0))
       Rcpp::stop("Argument requirements not fulfilled: n > 0 && size >= 0");
+    if (probs.isNotNull()) {
+      Rcpp::NumericVector _probs(probs.get());
+      if (_probs.length() != n)
+        Rcpp::stop("Argument requirements not fulfilled: n == length(prob)");
+      if (!replace && size > 1)
+        Rcpp::stop("Weighted sampling without replacement is not supported!");
+      return dqrng::sample::replacement_weighted<Rcpp::IntegerVector, uint32_t>(*rng, _probs.begin(), _probs.end(), uint32_t(size), offset);
+    }
     return dqrng::sample::sample<Rcpp::IntegerVector, uint32_t>(*rng, uint32_t(n), uint32_t(size), replace, offset);
 }
 
@@ -206,10 +1565,108 @@ Rcpp::NumericVector dqsample_num(double n,
 #ifndef LONG_VECTOR_SUPPORT
     Rcpp::stop("Long vectors are not supported");
 #else
+    if (probs.isNotNull()) {
+      Rcpp::NumericVector _probs(probs.get());
+      if (double(_probs.length()) != n)
+        Rcpp::stop("Argument requirements not fulfilled: n == length(prob)");
+      if (!replace && size > 1)
+        Rcpp::stop("Weighted sampling without replacement is not supported!");
+      return dqrng::sample::replacement_weighted<Rcpp::NumericVector, uint64_t>(*rng, _probs.begin(), _probs.end(), uint64_t(size), offset);
+    }
     return dqrng::sample::sample<Rcpp::NumericVector, uint64_t>(*rng, uint64_t(n), uint64_t(size), replace, offset);
 #endif
 }
 
+//' @title Random permutations
+//'
+//' @description \code{dqrperm_matrix} generates many independent random
+//'   permutations at once using the currently selected RNG.
+//'
+//' @param n  length of the permutations
+//' @param B  number of permutations
+//' @param threads  number of threads; only effective when OpenMP is available
+//'
+//' @return integer \code{n x B} matrix where each column is a random
+//'   permutation of \code{1:n}
+//'
+//' @details All permutations are generated with the Fisher-Yates shuffle in a
+//'   single scratch buffer, which is copied to the columns of the result.
+//'   The random indices for up to six consecutive swaps are derived from one
+//'   64 bit random number with the batched method by Brackett-Rozinsky and
+//'   Lemire (2024). With \code{threads > 1} the columns are split into
+//'   \code{threads} chunks that are filled from independent streams of the
+//'   current RNG, in parallel if OpenMP is available. The result depends on
+//'   \code{threads}, but not on the number of available cores.
+//'
+//' @seealso \code{\link{dqsample.int}}
+//'
+//' @examples
+//' dqrperm_matrix(5, 3)
+//' # null distribution of a permutation test statistic
+//' x <- c(dqrnorm(10), dqrnorm(10, mean = 1))
+//' g <- rep(1:2, each = 10)
+//' perm <- dqrperm_matrix(20, 1000)
+//' stat <- apply(perm, 2, function(i) diff(tapply(x, g[i], mean)))
+//' mean(abs(stat) >= abs(diff(tapply(x, g, mean))))
+//'
+//' @rdname dqrperm_matrix
+//' @export
+// [[Rcpp::export(rng = false)]]
+Rcpp::IntegerMatrix dqrperm_matrix(int n, int B, int threads = 1) {
+  if (!(n >= 0 && B >= 0))
+    Rcpp::stop("Argument requirements not fulfilled: n >= 0 && B >= 0");
+  Rcpp::IntegerMatrix out(Rcpp::no_init(n, B));
+  std::size_t cols = B;
+  if (threads <= 1) {
+    generate_permutations(*rng, out.begin(), n, 0, cols);
+    return out;
+  }
+  auto streams = parallel_streams(threads);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(std::min(threads, omp_get_num_procs())) schedule(static, 1)
+#endif
+  for (int i = 0; i < threads; ++i) {
+    std::size_t start = cols / threads * i + std::min(cols % threads, std::size_t(i));
+    std::size_t end = start + cols / threads + (std::size_t(i) < cols % threads ? 1 : 0);
+    generate_permutations(*streams[i], out.begin(), n, start, end);
+  }
+  return out;
+}
+
+//' @rdname dqsample
+//' @export
+// [[Rcpp::export(rng = false)]]
+SEXP dqalias_table(Rcpp::NumericVector prob) {
+  using table_t = dqrng::alias_table<uint32_t>;
+  Rcpp::XPtr<table_t> table(new table_t(prob.begin(), prob.end()));
+  table.attr("class") = "dqrng_alias_table";
+  return table;
+}
+
+// [[Rcpp::export(rng = false)]]
+Rcpp::IntegerVector dqsample_alias_int(SEXP table, int n, int size, int offset = 0) {
+  Rcpp::XPtr<dqrng::alias_table<uint32_t>> _table(table);
+  if (!(n > 0 && size >= 0))
+    Rcpp::stop("Argument requirements not fulfilled: n > 0 && size >= 0");
+  if (_table->size() != uint32_t(n))
+    Rcpp::stop("Argument requirements not fulfilled: n == length(prob)");
+  return dqrng::sample::replacement_alias<Rcpp::IntegerVector, uint32_t>(*rng, *_table, uint32_t(size), offset);
+}
+
+// [[Rcpp::export(rng = false)]]
+Rcpp::NumericVector dqsample_alias_num(SEXP table, double n, double size, int offset = 0) {
+  Rcpp::XPtr<dqrng::alias_table<uint32_t>> _table(table);
+  if (!(n > 0 && size >= 0))
+    Rcpp::stop("Argument requirements not fulfilled: n > 0 && size >= 0");
+  if (_table->size() != uint64_t(n))
+    Rcpp::stop("Argument requirements not fulfilled: n == length(prob)");
+#ifndef LONG_VECTOR_SUPPORT
+  Rcpp::stop("Long vectors are not supported");
+#else
+  return dqrng::sample::replacement_alias<Rcpp::NumericVector, uint64_t>(*rng, *_table, uint64_t(size), offset);
+#endif
+}
+
 extern "C" {
 // allow registering as user-supplied RNG
 double * user_unif_rand(void) {
@@ -232,7 +1689,7 @@ void user_unif_init(Int32 seed_in) {
 
 double * user_norm_rand(void) {
   static double res;
-  res = rng->variate<dqrng::normal_distribution>(0.0, 1.0);
+  res = rng->variate<dqrng::standard_normal_distribution>();
   return &res;
 }
 } // extern "C"